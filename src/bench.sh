@@ -0,0 +1,38 @@
+#!/bin/sh
+# Matriz de rendimiento de make bench: una linea CSV por carga generada.
+# Cada carga se genera una vez por tamano y cantidad de colas; la estrategia se
+# cambia al leerla. Variables:
+#  BENCH_SIZES       cantidades de procesos (por defecto 1000 ... 1000000; 10000000 requiere unos 10 GB de memoria)
+#  BENCH_STRATEGIES  estrategias (por defecto todas)
+#  BENCH_DIR         directorio de las cargas generadas (por defecto workloads)
+
+SIZES=${BENCH_SIZES:-"1000 10000 100000 1000000"}
+STRATEGIES=${BENCH_STRATEGIES:-"fifo sjf rr srt cfs edf lottery stride cp"}
+DIR=${BENCH_DIR:-workloads}
+
+mkdir -p "$DIR" || exit 1
+echo "size,queues,strategy,wall_s,events,events_per_s,peak_rss_kb,allocations,allocations_per_event"
+for n in $SIZES; do
+  for queues in 1 3; do
+    # Tasa de llegadas con 90% de utilizacion de un procesador (tiempo medio de CPU 10)
+    workload="$DIR/n$n-q$queues.txt"
+    if [ ! -f "$workload" ]; then
+      if [ "$queues" = 1 ]; then
+        mix="fifo:1"
+      else
+        mix="fifo:1,fifo:2,fifo:1"
+      fi
+      ./generator n="$n" seed=1 rate=0.09 mean=10 queues="$mix" > "$workload" || exit 1
+    fi
+    for s in $STRATEGIES; do
+      result=$( { echo "DEFINE quiet on"; sed "s/^DEFINE scheduling \([0-9]*\) fifo/DEFINE scheduling \1 $s/" "$workload"; } |
+                ./scheduler-bench 2>&1 >"$DIR/last.out")
+      events=$(sed -n 's/^Simulated events: //p' "$DIR/last.out" | tail -1)
+      echo "$result" | awk -v n="$n" -v q="$queues" -v s="$s" -v e="${events:-0}" '
+        /^bench / {
+          split($2, w, "="); split($3, r, "="); split($4, a, "=");
+          printf "%s,%s,%s,%.3f,%d,%.0f,%d,%d,%.3f\n", n, q, s, w[2], e, (w[2] > 0) ? e / w[2] : 0, r[2], a[2], (e > 0) ? a[2] / e : 0
+        }'
+    done
+  done
+done
@@ -0,0 +1,80 @@
+/**
+ * @file
+ * @brief Medicion del simulador para make bench: tiempo, memoria y asignaciones.
+ * @copyright MIT License
+ *
+ * Este archivo solo se enlaza en scheduler-bench, con las opciones
+ * -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=realloc: el enlazador
+ * dirige las llamadas del simulador a las funciones __wrap_*, que cuentan
+ * las asignaciones y llaman a la funcion original. Al terminar el programa
+ * se imprime en la salida de error una linea con el tiempo de pared, el
+ * maximo de memoria residente y la cantidad de asignaciones.
+ * Con make STATS=1 las funciones __wrap_* estan en stats.c, y aqui solo se
+ * lee su contador.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "stats.h"
+
+#ifdef SCHED_STATS
+
+/** @brief Asignaciones de memoria del simulador, contadas en stats.c */
+#define allocations stats.allocations
+
+#else
+
+/** @brief Funciones originales de la biblioteca de C */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+/** @brief Asignaciones de memoria del simulador */
+static unsigned long long allocations;
+
+/** @brief Cuenta una asignacion y llama a malloc */
+void *__wrap_malloc(size_t size)
+{
+  allocations++;
+  return __real_malloc(size);
+}
+
+/** @brief Cuenta una asignacion y llama a calloc */
+void *__wrap_calloc(size_t n, size_t size)
+{
+  allocations++;
+  return __real_calloc(n, size);
+}
+
+/** @brief Cuenta una asignacion y llama a realloc */
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  allocations++;
+  return __real_realloc(ptr, size);
+}
+
+#endif
+
+/** @brief Inicio de la ejecucion */
+static struct timespec started;
+
+/** @brief Registra el inicio de la ejecucion, antes de main */
+__attribute__((constructor)) static void bench_start(void)
+{
+  clock_gettime(CLOCK_MONOTONIC, &started);
+}
+
+/** @brief Imprime las mediciones al terminar el programa */
+__attribute__((destructor)) static void bench_report(void)
+{
+  struct timespec now;
+  struct rusage usage;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  getrusage(RUSAGE_SELF, &usage);
+  fprintf(stderr, "bench wall=%.6f rss_kb=%ld allocations=%llu\n",
+          (now.tv_sec - started.tv_sec) + (now.tv_nsec - started.tv_nsec) / 1e9, usage.ru_maxrss, allocations);
+}
@@ -0,0 +1,681 @@
+/**
+ * @file
+ * @brief Grupos de control jerarquicos con peso y cuota de CPU.
+ * @copyright MIT License
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cgroup.h"
+
+/**
+ * @brief CPU que un grupo todavia puede asignar en el periodo actual
+ * @param g Grupo de control
+ * @return Cuota sin consumir ni reservar, LONG_MAX si el grupo no tiene cuota
+ */
+static long available(control_group *g)
+{
+  return (g->quota > 0) ? g->quota - g->consumed - g->reserved : LONG_MAX;
+}
+
+/**
+ * @brief Verifica que un grupo y todos sus ancestros tengan cuota disponible
+ * @param cgroups Grupos de control
+ * @param g Indice del grupo
+ * @return 1 si los procesos del grupo pueden ejecutar
+ */
+static int runnable_path(control_group *cgroups, int g)
+{
+  for (; g >= 0; g = cgroups[g].parent)
+  {
+    if (available(&cgroups[g]) <= 0)
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/**
+ * @brief Verifica si un grupo es descendiente de otro
+ * @param cgroups Grupos de control
+ * @param g Indice del grupo
+ * @param ancestor Indice del posible ancestro
+ * @return 1 si g es ancestor o uno de sus descendientes
+ */
+static int descends(control_group *cgroups, int g, int ancestor)
+{
+  for (; g > ancestor; g = cgroups[g].parent)
+    ;
+  return g == ancestor;
+}
+
+/**
+ * @brief Procesos listos de un subarbol que pueden ejecutar si el grupo tiene cuota
+ * @param q Cola de prioridad dividida en grupos
+ * @param g Indice del grupo
+ * @return Procesos listos de g y sus descendientes, sin los subarboles sin cuota disponible
+ */
+static int runnable_below(priority_queue *q, int g)
+{
+  control_group *cg;
+  int total;
+  int a;
+  int i;
+
+  cg = q->cgroups;
+  total = q->members[g].runnable;
+  // Los descendientes tienen un indice mayor que su ancestro
+  for (i = g + 1; i < q->ncgroups; i++)
+  {
+    if (available(&cg[i]) > 0 || !descends(cg, i, g))
+    {
+      continue;
+    }
+    // Descontar cada subarbol sin cuota una sola vez, en su grupo mas alto bajo g
+    for (a = cg[i].parent; a != g && available(&cg[a]) > 0; a = cg[a].parent)
+      ;
+    if (a == g)
+    {
+      total -= q->members[i].runnable;
+    }
+  }
+  return total;
+}
+
+/**
+ * @brief Marca un grupo que agoto su cuota; sus descendientes tampoco pueden ejecutar
+ * @param q Cola de prioridad dividida en grupos
+ * @param g Indice del grupo
+ * @param now Tiempo actual
+ * @param config Configuracion de la simulacion
+ */
+static void throttle(priority_queue *q, int g, int now, const sched_config *config)
+{
+  control_group *cg;
+  int i;
+
+  cg = q->cgroups;
+  cg[g].throttled = 1;
+  cg[g].throttled_at = now;
+  cg[g].nr_throttled++;
+  trace(config, "[%d] Group %s throttled (quota %d per %d exhausted)\n", now, cg[g].name, cg[g].quota, cg[g].period);
+
+  // Los descendientes tienen un indice mayor que su ancestro
+  for (i = g; i < q->ncgroups; i++)
+  {
+    if (descends(cg, i, g) && cg[i].depth++ == 0)
+    {
+      cg[i].blocked_since = now;
+    }
+  }
+}
+
+/**
+ * @brief Libera un grupo al iniciar su periodo y registra el intervalo en el que no pudo ejecutar
+ * @param q Cola de prioridad dividida en grupos
+ * @param g Indice del grupo
+ * @param now Tiempo actual
+ * @param config Configuracion de la simulacion
+ */
+static void unthrottle(priority_queue *q, int g, int now, const sched_config *config)
+{
+  control_group *cg;
+  slice *s;
+  int i;
+
+  cg = q->cgroups;
+  cg[g].throttled = 0;
+  cg[g].throttled_total += now - cg[g].throttled_at;
+  trace(config, "[%d] Group %s unthrottled\n", now, cg[g].name);
+
+  for (i = g; i < q->ncgroups; i++)
+  {
+    if (descends(cg, i, g) && --cg[i].depth == 0 && now > cg[i].blocked_since)
+    {
+      s = (slice *)malloc(sizeof(slice));
+      s->type = THROTTLED;
+      s->from = cg[i].blocked_since;
+      s->to = now;
+      push_back(cg[i].throttles, s);
+    }
+  }
+}
+
+/**
+ * @brief Inserta un proceso en la cola de su grupo
+ * @param q Cola de prioridad dividida en grupos
+ * @param p Proceso
+ * @param preempted 1 si el proceso fue expropiado (usa on_preempt de la estrategia)
+ */
+static void insert_member(priority_queue *q, process *p, int preempted)
+{
+  control_group *cg;
+  priority_queue *m;
+  int g;
+
+  cg = q->cgroups;
+  g = p->cgroup;
+  m = &q->members[g];
+
+  // Un grupo que vuelve a tener procesos listos no puede reclamar el tiempo que estuvo inactivo
+  if (m->ops->count(m) == 0 && cg[g].self_vruntime < cg[g].min_vruntime)
+  {
+    cg[g].self_vruntime = cg[g].min_vruntime;
+  }
+  for (; g > 0; g = cg[g].parent)
+  {
+    if (q->members[g].runnable == 0 && cg[g].vruntime < cg[cg[g].parent].min_vruntime)
+    {
+      cg[g].vruntime = cg[cg[g].parent].min_vruntime;
+    }
+  }
+
+  if (preempted)
+  {
+    m->ops->on_preempt(m, p);
+  }
+  else
+  {
+    m->ops->enqueue(m, p);
+  }
+  for (g = p->cgroup; g >= 0; g = cg[g].parent)
+  {
+    q->members[g].runnable++;
+  }
+}
+
+/**
+ * @brief Inserta un proceso que llega en la cola de su grupo
+ * @param q Cola de prioridad dividida en grupos
+ * @param p Proceso
+ */
+static void cgroup_enqueue(priority_queue *q, process *p)
+{
+  insert_member(q, p, 0);
+}
+
+/**
+ * @brief Devuelve un proceso expropiado a la cola de su grupo
+ * @param q Cola de prioridad dividida en grupos
+ * @param p Proceso
+ */
+static void cgroup_requeue(priority_queue *q, process *p)
+{
+  insert_member(q, p, 1);
+}
+
+/**
+ * @brief Elige desde la raiz el hijo con menor tiempo virtual y cuota disponible,
+ * y retira el siguiente proceso del grupo elegido
+ * @param q Cola de prioridad dividida en grupos
+ * @return Proceso elegido, NULL si ningun grupo puede ejecutar
+ */
+static process *cgroup_pick(priority_queue *q)
+{
+  control_group *cg;
+  process *p;
+  long long v;
+  int best;
+  int g;
+  int i;
+
+  cg = q->cgroups;
+  g = 0;
+  for (;;)
+  {
+    // Los procesos propios del grupo compiten con sus hijos
+    best = (q->members[g].ops->count(&q->members[g]) > 0) ? g : -1;
+    v = cg[g].self_vruntime;
+    for (i = g + 1; i < q->ncgroups; i++)
+    {
+      // Un hijo con procesos listos solo en subarboles sin cuota no puede ejecutar
+      if (cg[i].parent == g && available(&cg[i]) > 0 && runnable_below(q, i) > 0 &&
+          (best < 0 || cg[i].vruntime < v))
+      {
+        best = i;
+        v = cg[i].vruntime;
+      }
+    }
+    if (best < 0)
+    {
+      return NULL;
+    }
+    if (v > cg[g].min_vruntime)
+    {
+      cg[g].min_vruntime = v;
+    }
+    if (best == g)
+    {
+      break;
+    }
+    g = best;
+  }
+
+  p = q->members[g].ops->pick(&q->members[g]);
+  for (; g >= 0; g = cg[g].parent)
+  {
+    q->members[g].runnable--;
+  }
+  return p;
+}
+
+/**
+ * @brief Tiempo de ejecucion de la estrategia del grupo, limitado por la cuota disponible.
+ * El tiempo se reserva de la cuota del grupo y de sus ancestros.
+ * @param q Cola de prioridad dividida en grupos
+ * @param p Proceso a ejecutar
+ * @return Tiempo de ejecucion
+ */
+static int cgroup_slice(priority_queue *q, process *p)
+{
+  control_group *cg;
+  long run;
+  int g;
+
+  // Los hilos de un grupo gang reservan su tiempo comun antes de salir de la espera
+  if (p->reserved > 0)
+  {
+    return p->reserved;
+  }
+  cg = q->cgroups;
+  run = q->members[p->cgroup].ops->slice(&q->members[p->cgroup], p);
+  for (g = p->cgroup; g >= 0; g = cg[g].parent)
+  {
+    if (available(&cg[g]) < run)
+    {
+      run = available(&cg[g]);
+    }
+  }
+  p->reserved = (int)run;
+  for (g = p->cgroup; g >= 0; g = cg[g].parent)
+  {
+    cg[g].reserved += run;
+  }
+  return (int)run;
+}
+
+/**
+ * @brief Expropia al proceso si su grupo no tiene cuota, o si la estrategia del grupo lo indica
+ * @param q Cola de prioridad dividida en grupos
+ * @param p Proceso en ejecucion
+ * @param used Tiempo ejecutado
+ * @return 1 si el proceso debe ser expropiado
+ */
+static int cgroup_expire(priority_queue *q, process *p, int used)
+{
+  if (!runnable_path(q->cgroups, p->cgroup))
+  {
+    return 1;
+  }
+  return q->members[p->cgroup].ops->on_tick(&q->members[p->cgroup], p, used);
+}
+
+/**
+ * @brief Cantidad de procesos listos que pueden ejecutar
+ * @param q Cola de prioridad dividida en grupos
+ * @return Procesos listos fuera de los grupos sin cuota disponible; si es mayor que cero, pick elige uno
+ */
+static int cgroup_count(priority_queue *q)
+{
+  return runnable_below(q, 0);
+}
+
+/**
+ * @brief Retira un proceso listo de la cola de su grupo
+ * @param q Cola de prioridad dividida en grupos
+ * @param p Proceso
+ */
+static void cgroup_remove(priority_queue *q, process *p)
+{
+  int g;
+
+  q->members[p->cgroup].ops->remove(&q->members[p->cgroup], p);
+  for (g = p->cgroup; g >= 0; g = q->cgroups[g].parent)
+  {
+    q->members[g].runnable--;
+  }
+}
+
+const strategy_ops cgroup_ops = {"CGROUP", cgroup_enqueue, cgroup_pick, cgroup_slice, cgroup_expire, cgroup_requeue, cgroup_count, cgroup_remove};
+
+int quota_exhausted(priority_queue *q, process *p, int used)
+{
+  if (q->cgroups == NULL || runnable_path(q->cgroups, p->cgroup))
+  {
+    return 0;
+  }
+  return !q->members[p->cgroup].ops->on_tick(&q->members[p->cgroup], p, used);
+}
+
+int reserve_gang(priority_queue *queues, process_group *g)
+{
+  control_group *cg;
+  priority_queue *q;
+  process *p;
+  long run;
+  int n;
+  int c;
+  int i;
+
+  // Los hilos de un grupo se crean en la misma linea PROCESS: comparten su grupo de control
+  p = NULL;
+  n = 0;
+  run = LONG_MAX;
+  for (i = 0; i < g->size; i++)
+  {
+    if (g->threads[i]->state != PARKED)
+    {
+      continue;
+    }
+    p = g->threads[i];
+    q = &queues[p->priority];
+    if (q->cgroups == NULL)
+    {
+      return 1;
+    }
+    if (q->members[p->cgroup].ops->slice(&q->members[p->cgroup], p) < run)
+    {
+      run = q->members[p->cgroup].ops->slice(&q->members[p->cgroup], p);
+    }
+    n++;
+  }
+  if (p == NULL)
+  {
+    return 1;
+  }
+
+  // Todos los hilos ejecutan el mismo tiempo, asi dejan la CPU juntos
+  cg = queues[p->priority].cgroups;
+  for (c = p->cgroup; c >= 0; c = cg[c].parent)
+  {
+    if (available(&cg[c]) / n < run)
+    {
+      run = available(&cg[c]) / n;
+    }
+  }
+  if (run <= 0)
+  {
+    return 0;
+  }
+  for (i = 0; i < g->size; i++)
+  {
+    if (g->threads[i]->state == PARKED)
+    {
+      g->threads[i]->reserved = (int)run;
+    }
+  }
+  for (c = p->cgroup; c >= 0; c = cg[c].parent)
+  {
+    cg[c].reserved += run * n;
+  }
+  return 1;
+}
+
+int cgroup_limit(process_table *table, int g)
+{
+  int limit;
+
+  limit = INT_MAX;
+  if (table->ncgroups == 0)
+  {
+    return limit;
+  }
+  for (; g >= 0; g = table->cgroups[g].parent)
+  {
+    if (table->cgroups[g].quota > 0 && table->cgroups[g].quota < limit)
+    {
+      limit = table->cgroups[g].quota;
+    }
+  }
+  return limit;
+}
+
+int find_cgroup(process_table *table, const char *path)
+{
+  int i;
+
+  for (i = 0; i < table->ncgroups; i++)
+  {
+    if (strcmp(table->cgroups[i].name, path) == 0)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int create_cgroup(process_table *table, char *path, int weight, int quota, int period)
+{
+  control_group *g;
+  char *slash;
+  int parent;
+
+  if (table->cgroups == 0)
+  {
+    table->cgroups = (control_group *)calloc(MAX_CGROUPS, sizeof(control_group));
+    table->cgroups[0].name = intern(table->names, "/");
+    table->cgroups[0].parent = -1;
+    table->cgroups[0].weight = CGROUP_WEIGHT;
+    table->cgroups[0].throttles = create_list();
+    table->ncgroups = 1;
+  }
+  if (find_cgroup(table, path) >= 0)
+  {
+    fprintf(stderr, "Group %s already exists\n", path);
+    return -1;
+  }
+  if (table->ncgroups == MAX_CGROUPS)
+  {
+    fprintf(stderr, "At most %d control groups can be defined\n", MAX_CGROUPS - 1);
+    return -1;
+  }
+
+  // El padre de web/api es web; el de web es la raiz
+  parent = 0;
+  slash = strrchr(path, '/');
+  if (slash != 0)
+  {
+    *slash = 0;
+    parent = find_cgroup(table, path);
+    if (parent < 0)
+    {
+      fprintf(stderr, "Parent group %s does not exist\n", path);
+    }
+    *slash = '/';
+    if (parent < 0)
+    {
+      return -1;
+    }
+  }
+
+  g = &table->cgroups[table->ncgroups];
+  g->name = intern(table->names, path);
+  g->parent = parent;
+  g->weight = (weight > 0) ? weight : CGROUP_WEIGHT;
+  g->quota = (quota > 0 && period > 0) ? quota : 0;
+  g->period = (quota > 0 && period > 0) ? period : 0;
+  g->throttles = create_list();
+
+  return table->ncgroups++;
+}
+
+void prepare_cgroups(process_table *table, priority_queue *queues, int nqueues, timing_wheel *wheel,
+                     const sched_config *config)
+{
+  control_group *g;
+  priority_queue *m;
+  int first;
+  int i;
+  int j;
+
+  first = INT_MAX;
+  for (j = 0; j < table->ncgroups; j++)
+  {
+    g = &table->cgroups[j];
+    g->vruntime = 0;
+    g->self_vruntime = 0;
+    g->min_vruntime = 0;
+    g->consumed = 0;
+    g->reserved = 0;
+    g->throttled = 0;
+    g->depth = 0;
+    g->usage = 0;
+    g->nr_throttled = 0;
+    g->throttled_total = 0;
+    clear_list(g->throttles, 1);
+    if (g->quota > 0)
+    {
+      first = (g->period < first) ? g->period : first;
+    }
+  }
+
+  // Cada cola se divide en una cola por grupo con su misma estrategia
+  for (i = 0; i < nqueues; i++)
+  {
+    if (queues[i].members == 0)
+    {
+      queues[i].members = create_queues(MAX_CGROUPS);
+    }
+    for (j = 0; j < table->ncgroups; j++)
+    {
+      m = &queues[i].members[j];
+      m->strategy = queues[i].strategy;
+      m->quantum = queues[i].quantum;
+      m->latency = queues[i].latency;
+      m->granularity = queues[i].granularity;
+      reset_queue(m, table->count, config->seed + (unsigned long long)i * MAX_CGROUPS + j);
+    }
+    queues[i].ops = &cgroup_ops;
+    queues[i].cgroups = table->cgroups;
+    queues[i].ncgroups = table->ncgroups;
+  }
+
+  if (first != INT_MAX)
+  {
+    wheel_schedule(wheel, first, EV_PERIOD, NULL);
+  }
+}
+
+void charge_cgroups(priority_queue *q, process *p, int used, int now, const sched_config *config)
+{
+  control_group *cg;
+  int g;
+
+  cg = q->cgroups;
+  cg[p->cgroup].self_vruntime += (long long)used * VRUNTIME_SCALE;
+  for (g = p->cgroup; g >= 0; g = cg[g].parent)
+  {
+    cg[g].reserved -= p->reserved;
+    cg[g].consumed += used;
+    cg[g].usage += used;
+    // El tiempo virtual avanza mas lento para los grupos con mayor peso
+    if (g > 0)
+    {
+      cg[g].vruntime += (long long)used * CGROUP_WEIGHT * VRUNTIME_SCALE / cg[g].weight;
+    }
+    if (cg[g].quota > 0 && !cg[g].throttled && cg[g].consumed >= cg[g].quota)
+    {
+      throttle(q, g, now, config);
+    }
+  }
+  p->reserved = 0;
+}
+
+void refill_cgroups(priority_queue *q, int now, timing_wheel *wheel, const sched_config *config)
+{
+  control_group *g;
+  int next;
+  int i;
+
+  next = INT_MAX;
+  for (i = 1; i < q->ncgroups; i++)
+  {
+    g = &q->cgroups[i];
+    if (g->quota == 0)
+    {
+      continue;
+    }
+    if (now % g->period == 0)
+    {
+      g->consumed = 0;
+      if (g->throttled)
+      {
+        unthrottle(q, i, now, config);
+      }
+    }
+    if ((now / g->period + 1) * g->period < next)
+    {
+      next = (now / g->period + 1) * g->period;
+    }
+  }
+  wheel_schedule(wheel, next, EV_PERIOD, NULL);
+}
+
+void print_cgroup_report(process_table *table)
+{
+  control_group *g;
+  process *p;
+  char quota[24];
+  int makespan;
+  long throttled;
+  long wait;
+  long throttled_wait;
+  long turnaround;
+  int n;
+  int i;
+  int j;
+
+  if (table->ncgroups == 0)
+  {
+    return;
+  }
+
+  makespan = 0;
+  for (i = 0; i < table->count; i++)
+  {
+    makespan = (table_process(table, i)->finished_time > makespan) ? table_process(table, i)->finished_time : makespan;
+  }
+
+  printf("\nControl groups\n");
+  printf("%-16s %6s %10s %6s %7s %10s %9s %9s %9s %11s\n", "Group", "Weight", "Quota", "Usage", "Share",
+         "Throttled", "Thr.time", "Avg wait", "Avg thr.", "Turnaround");
+  for (i = 0; i < table->ncgroups; i++)
+  {
+    g = &table->cgroups[i];
+
+    // Latencia de los procesos del grupo y de sus descendientes
+    n = 0;
+    wait = 0;
+    throttled_wait = 0;
+    turnaround = 0;
+    for (j = 0; j < table->count; j++)
+    {
+      p = table_process(table, j);
+      if (descends(table->cgroups, p->cgroup, i))
+      {
+        n++;
+        wait += p->waiting_time;
+        throttled_wait += p->throttled_time;
+        turnaround += p->finished_time - p->arrival_time;
+      }
+    }
+    if (g->quota > 0)
+    {
+      snprintf(quota, sizeof(quota), "%d/%d", g->quota, g->period);
+    }
+    else
+    {
+      snprintf(quota, sizeof(quota), "-");
+    }
+    throttled = g->throttled_total + ((g->throttled && makespan > g->throttled_at) ? makespan - g->throttled_at : 0);
+    printf("%-16s %6d %10s %6ld %6.1f%% %10d %9ld %9.2f %9.2f %11.2f\n", g->name, g->weight, quota, g->usage,
+           (table->cgroups[0].usage > 0) ? 100.0 * g->usage / table->cgroups[0].usage : 0.0,
+           g->nr_throttled, throttled,
+           (n > 0) ? (double)wait / n : 0.0, (n > 0) ? (double)throttled_wait / n : 0.0,
+           (n > 0) ? (double)turnaround / n : 0.0);
+  }
+}
@@ -0,0 +1,109 @@
+#ifndef CGROUP_H
+#define CGROUP_H
+
+/**
+ * @file
+ * @brief Grupos de control jerarquicos con peso y cuota de CPU.
+ * @copyright MIT License
+ *
+ * Cuando se definen grupos de control, cada cola de prioridad se divide en
+ * una cola por grupo con la misma estrategia. La planificacion es de dos
+ * niveles: desde la raiz se elige el hijo con menor tiempo virtual (la CPU
+ * recibida dividida entre su peso) hasta llegar a un grupo, y la estrategia
+ * de la cola de ese grupo elige el proceso. Los procesos propios de un grupo
+ * compiten con sus hijos como una entidad de peso CGROUP_WEIGHT.
+ *
+ * Un grupo con cuota solo recibe quota unidades de CPU por periodo, contando
+ * las de sus descendientes. Cada asignacion reserva de la cuota el tiempo que
+ * el proceso puede ejecutar, de modo que varios procesadores no la exceden.
+ * Al agotarla, el grupo y sus descendientes no se eligen hasta el siguiente
+ * periodo; el tiempo que sus procesos listos esperan se registra como THROTTLED.
+ */
+
+#include "policy.h"
+#include "sched.h"
+
+/** @brief Operaciones de una cola dividida en grupos de control */
+extern const strategy_ops cgroup_ops;
+
+/**
+ * @brief Crea un grupo de control. La raiz "/" se crea con el primer grupo.
+ * @param table Tabla de procesos
+ * @param path Ruta del grupo (ej. web/api); el padre (web) debe existir
+ * @param weight Peso frente a sus hermanos
+ * @param quota CPU por periodo, 0 = sin limite
+ * @param period Duracion del periodo de la cuota
+ * @return Indice del grupo, -1 si no se pudo crear
+ */
+int create_cgroup(process_table *table, char *path, int weight, int quota, int period);
+
+/**
+ * @brief Busca un grupo de control por su ruta
+ * @param table Tabla de procesos
+ * @param path Ruta del grupo
+ * @return Indice del grupo, -1 si no existe
+ */
+int find_cgroup(process_table *table, const char *path);
+
+/**
+ * @brief Divide las colas de prioridad en grupos de control para una nueva simulacion
+ * @param table Tabla de procesos con los grupos definidos
+ * @param queues Arreglo de colas de prioridad, ya preparadas
+ * @param nqueues Cantidad de colas de prioridad
+ * @param wheel Rueda de tiempo que recibe el inicio de los periodos
+ * @param config Parametros de la simulacion
+ */
+void prepare_cgroups(process_table *table, priority_queue *queues, int nqueues, timing_wheel *wheel,
+                     const sched_config *config);
+
+/**
+ * @brief Descuenta la CPU de un proceso de sus grupos de control y libera su reserva
+ * @param q Cola de prioridad dividida en grupos
+ * @param p Proceso que deja la CPU
+ * @param used Tiempo de CPU ejecutado
+ * @param now Tiempo actual
+ * @param config Configuracion de la simulacion
+ */
+void charge_cgroups(priority_queue *q, process *p, int used, int now, const sched_config *config);
+
+/**
+ * @brief Inicia el periodo de los grupos cuyo periodo comienza en el tiempo actual
+ * @param q Cola de prioridad dividida en grupos
+ * @param now Tiempo actual
+ * @param wheel Rueda de tiempo que recibe el siguiente inicio de periodo
+ * @param config Configuracion de la simulacion
+ */
+void refill_cgroups(priority_queue *q, int now, timing_wheel *wheel, const sched_config *config);
+
+/**
+ * @brief Indica si la expropiacion de un proceso se debe solo a la cuota de sus grupos
+ * @param q Cola de prioridad del proceso
+ * @param p Proceso expropiado
+ * @param used Tiempo ejecutado desde que tomo la CPU
+ * @return 1 si algun grupo del proceso agoto su cuota y la estrategia del grupo no lo habria expropiado
+ */
+int quota_exhausted(priority_queue *q, process *p, int used);
+
+/**
+ * @brief Reserva de la cuota el mismo tiempo de ejecucion para cada hilo en espera de un grupo gang
+ * @param queues Arreglo de colas de prioridad
+ * @param g Grupo con todos sus hilos en espera
+ * @return 1 si la cuota alcanza para todos los hilos o si no hay grupos de control, 0 si el grupo debe esperar
+ */
+int reserve_gang(priority_queue *queues, process_group *g);
+
+/**
+ * @brief Cuota mas pequena de un grupo de control y de sus ancestros
+ * @param table Tabla de procesos
+ * @param g Indice del grupo
+ * @return Cuota por periodo, INT_MAX si ningun grupo de la ruta tiene cuota
+ */
+int cgroup_limit(process_table *table, int g);
+
+/**
+ * @brief Imprime la CPU recibida, las veces que se agoto la cuota y la latencia de cada grupo
+ * @param table Tabla de procesos simulados
+ */
+void print_cgroup_report(process_table *table);
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @brief Clientes de ciclo cerrado con tiempos de reflexion.
+ * @copyright MIT License
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "client.h"
+#include "util.h"
+
+int create_client_pool(process_table *table, char *name, int clients, int jobs, int think)
+{
+  client_pool *pool;
+
+  table->pools = (client_pool *)realloc(table->pools, sizeof(client_pool) * (table->npools + 1));
+  pool = &table->pools[table->npools];
+  pool->name = intern(table->names, name);
+  pool->clients = clients;
+  pool->jobs = jobs;
+  pool->think = think;
+  pool->first = table->count;
+
+  return table->npools++;
+}
+
+void prepare_clients(process_table *table, const sched_config *config)
+{
+  client_pool *pool;
+  process *p;
+  unsigned long long rng;
+  double u;
+  int i;
+  int j;
+
+  // Generador propio, independiente de los sorteos de las colas
+  rng = ~config->seed;
+  for (i = 0; i < table->npools; i++)
+  {
+    pool = &table->pools[i];
+    for (j = 0; j < pool->clients * pool->jobs; j++)
+    {
+      p = table_process(table, pool->first + j);
+      // El primer trabajo de cada cliente llega en el tiempo de llegada
+      if (j % pool->jobs == 0)
+      {
+        p->think = 0;
+        continue;
+      }
+      // Tiempo exponencial: -media * ln(1 - u), con u uniforme en [0, 1)
+      u = (double)(next_random(&rng) >> 11) / 9007199254740992.0;
+      p->think = (int)floor(-pool->think * log(1.0 - u) + 0.5);
+    }
+  }
+}
+
+void print_client_report(process_table *table)
+{
+  client_pool *pool;
+  process *p;
+  long response;
+  long think;
+  int start;
+  int end;
+  int n;
+  int i;
+  int j;
+
+  if (table->npools == 0)
+  {
+    return;
+  }
+
+  printf("\nClosed-loop clients\n");
+  printf("%-20s%8s%6s%8s%10s%12s%10s\n", "Clients", "Count", "Jobs", "Think", "Response", "Throughput", "N/(R+Z)");
+  for (i = 0; i < table->npools; i++)
+  {
+    pool = &table->pools[i];
+    n = pool->clients * pool->jobs;
+    response = 0;
+    think = 0;
+    start = table_process(table, pool->first)->released;
+    end = 0;
+    for (j = 0; j < n; j++)
+    {
+      p = table_process(table, pool->first + j);
+      response += p->finished_time - p->released;
+      think += p->think;
+      start = min(start, p->released);
+      end = max(end, p->finished_time);
+    }
+    // Ley de Little para un sistema cerrado: X = N / (R + Z)
+    printf("%-20s%8d%6d%8.2f%10.2f%12.4f", pool->name, pool->clients, pool->jobs,
+           (pool->jobs > 1) ? (double)think / (n - pool->clients) : 0.0, (double)response / n,
+           (end > start) ? (double)n / (end - start) : 0.0);
+    if (response + think > 0)
+    {
+      printf("%10.4f\n", (double)pool->clients * n / (response + think));
+    }
+    else
+    {
+      printf("%10s\n", "-");
+    }
+  }
+}
@@ -0,0 +1,48 @@
+#ifndef CLIENT_H
+#define CLIENT_H
+
+/**
+ * @file
+ * @brief Clientes de ciclo cerrado con tiempos de reflexion.
+ * @copyright MIT License
+ *
+ * Cada cliente de una linea CLIENT emite un trabajo, espera a que termine,
+ * reflexiona durante un tiempo aleatorio y emite el siguiente. El cliente es
+ * una maquina de estados que el ciclo de simulacion reanuda al terminar cada
+ * trabajo: sus trabajos se crean de antemano como una cadena de dependencias,
+ * y el trabajo k+1 llega el tiempo de reflexion despues del fin del trabajo k.
+ * Asi la carga baja cuando sube la latencia, como en un servicio interactivo.
+ *
+ * Los tiempos de reflexion siguen una distribucion exponencial con la media
+ * de la linea CLIENT, y se sortean al preparar cada simulacion con la semilla
+ * de la configuracion, de modo que la misma semilla reproduce la ejecucion.
+ */
+
+#include "sched.h"
+
+/**
+ * @brief Crea un conjunto de clientes. Sus trabajos se deben crear a continuacion en la tabla,
+ * cliente por cliente.
+ * @param table Tabla de procesos
+ * @param name Nombre de los clientes
+ * @param clients Cantidad de clientes
+ * @param jobs Trabajos de cada cliente
+ * @param think Tiempo medio de reflexion entre trabajos
+ * @return Indice del conjunto de clientes
+ */
+int create_client_pool(process_table *table, char *name, int clients, int jobs, int think);
+
+/**
+ * @brief Sortea los tiempos de reflexion de los trabajos para una nueva simulacion
+ * @param table Tabla de procesos
+ * @param config Parametros de la simulacion
+ */
+void prepare_clients(process_table *table, const sched_config *config);
+
+/**
+ * @brief Imprime el tiempo de respuesta y el rendimiento de cada conjunto de clientes
+ * @param table Tabla de procesos simulados
+ */
+void print_client_report(process_table *table);
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file
+ * @brief Dependencias entre procesos: grafo aciclico, camino critico y makespan.
+ * @copyright MIT License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dag.h"
+
+void add_dependency(process *pred, process *succ)
+{
+  pred->successors = (process **)realloc(pred->successors, sizeof(process *) * (pred->nsuccessors + 1));
+  pred->successors[pred->nsuccessors++] = succ;
+  succ->npredecessors++;
+}
+
+void compute_critical_path(process_table *table)
+{
+  process *p;
+  long longest;
+  int i;
+  int j;
+
+  // Los sucesores se crean despues que sus predecesores
+  for (i = table->count - 1; i >= 0; i--)
+  {
+    p = table_process(table, i);
+    longest = 0;
+    for (j = 0; j < p->nsuccessors; j++)
+    {
+      longest = max(longest, p->successors[j]->critical);
+    }
+    p->critical = p->execution_time + longest;
+  }
+}
+
+/**
+ * @brief Verifica si un proceso es un trabajo de un cliente de ciclo cerrado
+ * @param table Tabla de procesos
+ * @param i Indice del proceso en la tabla
+ * @return 1 si el proceso fue creado por una linea CLIENT
+ */
+static int client_job(process_table *table, int i)
+{
+  client_pool *pool;
+  int j;
+
+  for (j = 0; j < table->npools; j++)
+  {
+    pool = &table->pools[j];
+    if (i >= pool->first && i < pool->first + pool->clients * pool->jobs)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void print_dag_report(process_table *table, int ncpus)
+{
+  process *p;
+  process *s;
+  process **via;
+  process **chain;
+  long *start;
+  long work;
+  long bound;
+  long finish;
+  long dependency_wait;
+  int waiting;
+  int first_arrival;
+  int makespan;
+  int edges;
+  int last;
+  int i;
+  int j;
+
+  edges = 0;
+  for (i = 0; i < table->count; i++)
+  {
+    edges += table_process(table, i)->nsuccessors;
+  }
+  if (edges == 0)
+  {
+    return;
+  }
+
+  // Inicio mas temprano con procesadores ilimitados, en orden topologico, incluyendo los tiempos de reflexion
+  start = (long *)malloc(sizeof(long) * table->count);
+  via = (process **)malloc(sizeof(process *) * table->count);
+  chain = (process **)malloc(sizeof(process *) * table->count);
+  for (i = 0; i < table->count; i++)
+  {
+    start[i] = table_process(table, i)->arrival_time;
+    via[i] = NULL;
+  }
+  work = 0;
+  bound = 0;
+  last = 0;
+  makespan = 0;
+  dependency_wait = 0;
+  waiting = 0;
+  first_arrival = table_process(table, 0)->arrival_time;
+  for (i = 0; i < table->count; i++)
+  {
+    p = table_process(table, i);
+    finish = start[i] + p->execution_time;
+    for (j = 0; j < p->nsuccessors; j++)
+    {
+      // El pid es la posicion del proceso en la tabla, mas uno
+      s = p->successors[j];
+      if (finish + s->think > start[s->pid - 1])
+      {
+        start[s->pid - 1] = finish + s->think;
+        via[s->pid - 1] = p;
+      }
+    }
+    if (finish > bound)
+    {
+      bound = finish;
+      last = i;
+    }
+    work += p->execution_time;
+    makespan = max(makespan, p->finished_time);
+    first_arrival = min(first_arrival, p->arrival_time);
+    // Los trabajos de un cliente no tienen tiempo de llegada propio
+    if (!client_job(table, i))
+    {
+      dependency_wait += p->released - p->arrival_time;
+      waiting++;
+    }
+  }
+
+  printf("\nDependencies: %d processes, %d edges, dependency wait %ld (average %.3f)\n", table->count, edges,
+         dependency_wait, (waiting > 0) ? (double)dependency_wait / waiting : 0.0);
+  printf("Makespan: %d (critical path bound %ld, work bound %.1f on %d CPUs, %.1f%% of the best bound)\n",
+         makespan, bound, first_arrival + (double)work / ncpus, ncpus,
+         100.0 * max((double)bound, first_arrival + (double)work / ncpus) / makespan);
+
+  // Recorrer el camino critico desde el ultimo proceso hasta su origen, e imprimirlo en orden
+  j = 0;
+  for (p = table_process(table, last); p != NULL; p = via[p->pid - 1])
+  {
+    chain[j++] = p;
+  }
+  printf("Critical path:");
+  for (i = j - 1; i >= 0; i--)
+  {
+    printf(" %s%s", chain[i]->name, (i > 0) ? " ->" : "");
+  }
+  printf("\n");
+
+  free(start);
+  free(via);
+  free(chain);
+}
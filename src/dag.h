@@ -0,0 +1,44 @@
+#ifndef DAG_H
+#define DAG_H
+
+/**
+ * @file
+ * @brief Dependencias entre procesos: grafo aciclico, camino critico y makespan.
+ * @copyright MIT License
+ *
+ * Un proceso solo puede depender de procesos definidos antes que el, de modo
+ * que el grafo es aciclico y el orden de creacion de la tabla es un orden
+ * topologico. Cada proceso guarda sus sucesores y su grado de entrada: al
+ * terminar un proceso se descuenta el grado de entrada de sus sucesores, sin
+ * recorrer listas.
+ *
+ * El camino critico de un proceso es su tiempo de CPU mas el de la cadena de
+ * sucesores mas larga. El makespan se compara con dos cotas inferiores: la
+ * del camino critico con procesadores ilimitados (mas los tiempos de
+ * reflexion de los clientes), y la del trabajo total repartido entre los
+ * procesadores.
+ */
+
+#include "sched.h"
+
+/**
+ * @brief Agrega una dependencia: succ llega cuando pred termina
+ * @param pred Predecesor
+ * @param succ Sucesor, definido despues de pred
+ */
+void add_dependency(process *pred, process *succ);
+
+/**
+ * @brief Calcula el camino critico de cada proceso en orden topologico inverso
+ * @param table Tabla de procesos
+ */
+void compute_critical_path(process_table *table);
+
+/**
+ * @brief Imprime el makespan, sus cotas inferiores y el camino critico, si hay dependencias
+ * @param table Tabla de procesos simulados
+ * @param ncpus Cantidad de procesadores
+ */
+void print_dag_report(process_table *table, int ncpus);
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ * @file
+ * @brief Metricas de deadlines: incumplimientos, retraso y pruebas de factibilidad.
+ * @copyright MIT License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "deadline.h"
+
+/**
+ * @brief Compara dos enteros para qsort
+ * @param a Entero A
+ * @param b Entero B
+ * @return Negativo, cero o positivo si A es menor, igual o mayor que B
+ */
+static int compare_int(const void *a, const void *b)
+{
+  int x = *(const int *)a;
+  int y = *(const int *)b;
+
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Compara dos procesos por deadline absoluto para qsort
+ * @param a Apuntador al proceso A
+ * @param b Apuntador al proceso B
+ * @return Negativo, cero o positivo si A vence antes, al mismo tiempo o despues que B
+ */
+static int compare_due(const void *a, const void *b)
+{
+  int x = absolute_deadline(*(process *const *)a);
+  int y = absolute_deadline(*(process *const *)b);
+
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Obtiene un percentil de un arreglo ordenado (rango mas cercano)
+ * @param sorted Arreglo ordenado
+ * @param n Cantidad de elementos
+ * @param pct Percentil, entre 0 y 100
+ * @return Valor del percentil
+ */
+static int percentile(const int *sorted, int n, double pct)
+{
+  int rank;
+
+  rank = (int)(pct / 100.0 * n + 0.999999);
+  if (rank < 1)
+  {
+    rank = 1;
+  }
+  if (rank > n)
+  {
+    rank = n;
+  }
+  return sorted[rank - 1];
+}
+
+/**
+ * @brief Prueba de demanda de procesador
+ * @param jobs Procesos con deadline, ordenados por deadline absoluto
+ * @param n Cantidad de procesos
+ * @param from Inicio del primer intervalo que excede la capacidad
+ * @param to Fin del primer intervalo que excede la capacidad
+ * @param demand Demanda del intervalo
+ * @return 1 si el conjunto es factible, 0 en caso contrario
+ */
+static int demand_check(process **jobs, int n, int *from, int *to, long *demand)
+{
+  int i;
+  int j;
+  int t1;
+  long acc;
+
+  // Los intervalos criticos comienzan en una llegada y terminan en un deadline
+  for (i = 0; i < n; i++)
+  {
+    t1 = jobs[i]->arrival_time;
+    acc = 0;
+    for (j = 0; j < n; j++)
+    {
+      if (jobs[j]->arrival_time < t1)
+      {
+        continue;
+      }
+      acc += jobs[j]->execution_time;
+      if (acc > (long)absolute_deadline(jobs[j]) - t1)
+      {
+        *from = t1;
+        *to = absolute_deadline(jobs[j]);
+        *demand = acc;
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+void print_deadline_report(process_table *table)
+{
+  process **jobs;
+  process *p;
+  int *lateness;
+  int n;
+  int i;
+  int missed;
+  long total_lateness;
+  double density;
+  int from;
+  int to;
+  long demand;
+
+  n = 0;
+  for (i = 0; i < table->count; i++)
+  {
+    if (table_process(table, i)->deadline > 0)
+    {
+      n++;
+    }
+  }
+  if (n == 0)
+  {
+    return;
+  }
+
+  jobs = (process **)malloc(sizeof(process *) * n);
+  lateness = (int *)malloc(sizeof(int) * n);
+
+  n = 0;
+  missed = 0;
+  total_lateness = 0;
+  density = 0.0;
+  for (i = 0; i < table->count; i++)
+  {
+    p = table_process(table, i);
+    if (p->deadline <= 0)
+    {
+      continue;
+    }
+    jobs[n] = p;
+    // Retraso: negativo si el proceso termina antes de su deadline
+    lateness[n] = p->finished_time - absolute_deadline(p);
+    if (lateness[n] > 0)
+    {
+      missed++;
+    }
+    total_lateness += lateness[n];
+    density += (double)p->execution_time / p->deadline;
+    n++;
+  }
+  qsort(lateness, n, sizeof(int), compare_int);
+
+  printf("\nDeadlines: %d processes, %d missed (%.1f%%)\n", n, missed, 100.0 * missed / n);
+  printf("Lateness: min %d p50 %d p90 %d p99 %d max %d mean %.3f\n",
+         lateness[0], percentile(lateness, n, 50), percentile(lateness, n, 90),
+         percentile(lateness, n, 99), lateness[n - 1], (double)total_lateness / n);
+  printf("Density: %.3f (%s)\n", density,
+         (density <= 1.0) ? "<= 1, all deadlines can be met with EDF" : "> 1, inconclusive");
+
+  if (n > DEMAND_CHECK_LIMIT)
+  {
+    printf("Demand check: skipped (more than %d processes with deadline)\n", DEMAND_CHECK_LIMIT);
+  }
+  else
+  {
+    qsort(jobs, n, sizeof(process *), compare_due);
+    if (demand_check(jobs, n, &from, &to, &demand))
+    {
+      printf("Demand check: feasible\n");
+    }
+    else
+    {
+      printf("Demand check: infeasible, demand %ld in [%d, %d] exceeds %d\n", demand, from, to, to - from);
+    }
+  }
+
+  free(jobs);
+  free(lateness);
+}
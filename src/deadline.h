@@ -0,0 +1,29 @@
+#ifndef DEADLINE_H
+#define DEADLINE_H
+
+/**
+ * @file
+ * @brief Metricas de deadlines: incumplimientos, retraso y pruebas de factibilidad.
+ * @copyright MIT License
+ *
+ * Solo se consideran los procesos con deadline. Cada proceso es un trabajo
+ * que debe recibir su tiempo de ejecucion entre su llegada y su deadline
+ * absoluto. La prueba de densidad es suficiente: si la suma de C/D no supera
+ * 1, EDF cumple todos los deadlines. La prueba de demanda es exacta para un
+ * procesador con expropiacion: el conjunto es factible si en ningun intervalo
+ * [t1, t2] la demanda de los trabajos que llegan desde t1 y vencen hasta t2
+ * supera t2 - t1.
+ */
+
+#include "sched.h"
+
+/** @brief Cantidad maxima de procesos con deadline para la prueba de demanda, que es O(n^2) */
+#define DEMAND_CHECK_LIMIT 4096
+
+/**
+ * @brief Imprime las metricas de deadlines de una simulacion, si algun proceso tiene deadline
+ * @param table Tabla de procesos simulados
+ */
+void print_deadline_report(process_table *table);
+
+#endif
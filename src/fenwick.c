@@ -0,0 +1,94 @@
+/**
+ * @file
+ * @brief Arbol de Fenwick de pesos (sorteo ponderado)
+ * @copyright MIT License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fenwick.h"
+
+fenwick *create_fenwick(int size)
+{
+   fenwick *ret;
+
+   ret = (fenwick *)malloc(sizeof(fenwick));
+
+   ret->size = size;
+   ret->tree = (long *)calloc(size + 1, sizeof(long));
+   ret->values = (long *)calloc(size + 1, sizeof(long));
+   ret->data = (void **)calloc(size + 1, sizeof(void *));
+   ret->mask = 1;
+   while (ret->mask * 2 <= size)
+   {
+      ret->mask *= 2;
+   }
+   ret->count = 0;
+   ret->total = 0;
+   return ret;
+}
+
+void destroy_fenwick(fenwick *f)
+{
+   if (f == 0)
+   {
+      return;
+   }
+   free(f->tree);
+   free(f->values);
+   free(f->data);
+   free(f);
+}
+
+void clear_fenwick(fenwick *f)
+{
+   if (f == 0)
+   {
+      return;
+   }
+   memset(f->tree, 0, sizeof(long) * (f->size + 1));
+   memset(f->values, 0, sizeof(long) * (f->size + 1));
+   f->count = 0;
+   f->total = 0;
+}
+
+void fenwick_set(fenwick *f, int i, long weight, void *data)
+{
+   long delta;
+
+   delta = weight - f->values[i];
+   if (f->values[i] == 0 && weight > 0)
+   {
+      f->count++;
+   }
+   else if (f->values[i] > 0 && weight == 0)
+   {
+      f->count--;
+   }
+   f->values[i] = weight;
+   f->data[i] = data;
+   f->total += delta;
+
+   for (i++; i <= f->size; i += i & -i)
+   {
+      f->tree[i] += delta;
+   }
+}
+
+int fenwick_find(const fenwick *f, long target)
+{
+   int pos;
+   int step;
+
+   // Descender por potencias de 2, restando las sumas parciales que no superan el objetivo
+   pos = 0;
+   for (step = f->mask; step > 0; step /= 2)
+   {
+      if (pos + step <= f->size && f->tree[pos + step] <= target)
+      {
+         pos += step;
+         target -= f->tree[pos];
+      }
+   }
+   return pos;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file
+ * @brief Arbol de Fenwick de pesos (sorteo ponderado)
+ * @copyright MIT License
+ */
+
+#ifndef _FENWICK_H
+#define _FENWICK_H
+
+/**
+ * @brief Arbol de Fenwick sobre un arreglo de pesos no negativos.
+ * Cada posicion tiene un peso y un dato asociado. Cambiar un peso y buscar
+ * la posicion que contiene una suma acumulada son O(log n).
+ */
+typedef struct
+{
+       long *tree;   /*!< Sumas parciales (base 1) */
+       long *values; /*!< Peso de cada posicion */
+       void **data;  /*!< Dato asociado a cada posicion */
+       int size;     /*!< Cantidad de posiciones */
+       int mask;     /*!< Mayor potencia de 2 menor o igual a size */
+       int count;    /*!< Posiciones con peso mayor que cero */
+       long total;   /*!< Suma de todos los pesos */
+} fenwick;
+
+/**
+ * @brief Crea un nuevo arbol con todos los pesos en cero.
+ * @param size Cantidad de posiciones
+ * @return Nuevo arbol.
+ */
+fenwick *create_fenwick(int size);
+
+/**
+ * @brief Libera la memoria asignada a un arbol (no libera los datos)
+ * @param f Arbol
+ */
+void destroy_fenwick(fenwick *f);
+
+/**
+ * @brief Pone en cero todos los pesos
+ * @param f Arbol
+ */
+void clear_fenwick(fenwick *f);
+
+/**
+ * @brief Asigna el peso y el dato de una posicion
+ * @param f Arbol
+ * @param i Posicion, entre 0 y size - 1
+ * @param weight Nuevo peso (0 = retirar)
+ * @param data Dato asociado
+ */
+void fenwick_set(fenwick *f, int i, long weight, void *data);
+
+/**
+ * @brief Busca la posicion en la cual la suma acumulada supera un valor
+ * @param f Arbol
+ * @param target Valor entre 0 y total - 1
+ * @return Posicion i tal que suma(0..i-1) <= target < suma(0..i)
+ */
+int fenwick_find(const fenwick *f, long target);
+
+#endif
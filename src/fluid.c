@@ -0,0 +1,343 @@
+/**
+ * @file
+ * @brief Aproximacion de procesador compartido (fluida) para colas RR.
+ * @copyright MIT License
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fluid.h"
+#include "heap.h"
+
+/** @brief Estado interno de un proceso durante la aproximacion */
+typedef struct
+{
+  fluid_estimate *e; /*!< Estimacion asociada */
+  int index;         /*!< Posicion en la lista de procesos */
+  int queue;         /*!< Cola de prioridad */
+  double key;        /*!< Clave de orden dentro de la cola */
+  int max_ready;     /*!< Maximo de procesos en la cola durante su estadia */
+} fluid_item;
+
+/**
+ * @brief Compara dos elementos por clave, y por orden en la lista si empatan.
+ * @param a Elemento A
+ * @param b Elemento B
+ * @return > 0 si a tiene prioridad sobre b
+ */
+static int compare_key(void *const a, void *const b)
+{
+  fluid_item *i1 = (fluid_item *)a;
+  fluid_item *i2 = (fluid_item *)b;
+
+  if (i1->key != i2->key)
+  {
+    return (i1->key < i2->key) ? 1 : -1;
+  }
+  return i2->index - i1->index;
+}
+
+/**
+ * @brief Compara dos elementos por tiempo de llegada (para qsort).
+ * @param a Apuntador al elemento A
+ * @param b Apuntador al elemento B
+ * @return < 0 si a llega antes que b
+ */
+static int compare_item_arrival(const void *a, const void *b)
+{
+  fluid_item *i1 = *(fluid_item **)a;
+  fluid_item *i2 = *(fluid_item **)b;
+
+  if (i1->e->p->arrival_time != i2->e->p->arrival_time)
+  {
+    return i1->e->p->arrival_time - i2->e->p->arrival_time;
+  }
+  return i1->index - i2->index;
+}
+
+/**
+ * @brief Indica si una cola se atiende como procesador compartido.
+ * @param q Cola de prioridad
+ * @return 1 si la cola es RR con quantum, 0 en caso contrario
+ */
+static int is_shared(priority_queue *q)
+{
+  return q->strategy == RR && q->quantum > 0;
+}
+
+/**
+ * @brief Registra la finalizacion de un proceso
+ * @param it Elemento que finaliza
+ * @param now Tiempo de finalizacion
+ * @param bound Error estimado
+ */
+static void finish_item(fluid_item *it, double now, double bound)
+{
+  process *p = it->e->p;
+
+  it->e->finished_time = now;
+  it->e->waiting_time = now - p->arrival_time - p->execution_time;
+  if (it->e->waiting_time < 0)
+  {
+    it->e->waiting_time = 0;
+  }
+  it->e->error_bound = bound;
+}
+
+fluid_result *schedule_fluid(list *processes, priority_queue *queues, int nqueues)
+{
+  fluid_result *r;
+  fluid_item *items;
+  fluid_item **order;
+  fluid_item *it;
+  fluid_item *running;
+  heap **ready;
+  double *vtime;
+  double *blocking;
+  double now;
+  double running_end;
+  double next_arrival;
+  double completion;
+  node_iterator nit;
+  int n;
+  int i;
+  int k;
+  int next_index;
+  int finished;
+  long seq;
+
+  r = (fluid_result *)malloc(sizeof(fluid_result));
+  n = processes->count;
+  r->count = n;
+  r->estimates = (fluid_estimate *)calloc(n > 0 ? n : 1, sizeof(fluid_estimate));
+  r->total_waiting = 0;
+  r->total_turnaround = 0;
+  r->total_error = 0;
+  r->events = 0;
+
+  items = (fluid_item *)malloc(sizeof(fluid_item) * (n > 0 ? n : 1));
+  order = (fluid_item **)malloc(sizeof(fluid_item *) * (n > 0 ? n : 1));
+
+  for (i = 0, nit = head(processes); nit != 0; nit = next(nit), i++)
+  {
+    r->estimates[i].p = (process *)nit->data;
+    items[i].e = &r->estimates[i];
+    items[i].index = i;
+    items[i].queue = r->estimates[i].p->priority;
+    items[i].max_ready = 0;
+    order[i] = &items[i];
+  }
+  qsort(order, n, sizeof(fluid_item *), compare_item_arrival);
+
+  // Un proceso puede quedar bloqueado por un quantum de una cola de menor prioridad
+  ready = (heap **)malloc(sizeof(heap *) * nqueues);
+  vtime = (double *)malloc(sizeof(double) * nqueues);
+  blocking = (double *)malloc(sizeof(double) * nqueues);
+  for (k = nqueues - 1; k >= 0; k--)
+  {
+    ready[k] = create_heap(compare_key);
+    vtime[k] = 0;
+    blocking[k] = 0;
+    if (k + 1 < nqueues)
+    {
+      blocking[k] = blocking[k + 1];
+      if (is_shared(&queues[k + 1]) && queues[k + 1].quantum > blocking[k])
+      {
+        blocking[k] = queues[k + 1].quantum;
+      }
+    }
+  }
+
+  now = 0;
+  seq = 0;
+  next_index = 0;
+  finished = 0;
+  running = NULL;
+  running_end = 0;
+
+  while (finished < n)
+  {
+    r->events++;
+
+    // Procesar las llegadas hasta el tiempo actual
+    while (next_index < n && order[next_index]->e->p->arrival_time <= now)
+    {
+      it = order[next_index++];
+      k = it->queue;
+      if (is_shared(&queues[k]))
+      {
+        // Etiqueta de finalizacion en tiempo virtual
+        it->key = vtime[k] + it->e->p->execution_time;
+      }
+      else if (queues[k].strategy == SJF || queues[k].strategy == SRT)
+      {
+        it->key = it->e->p->execution_time;
+      }
+      else
+      {
+        it->key = seq;
+      }
+      seq++;
+      heap_push(ready[k], it);
+      it->max_ready = ready[k]->count;
+    }
+
+    next_arrival = (next_index < n) ? order[next_index]->e->p->arrival_time : DBL_MAX;
+
+    // Seleccionar la cola a atender
+    k = -1;
+    if (running == NULL)
+    {
+      for (i = 0; i < nqueues && k < 0; i++)
+      {
+        if (!heap_empty(ready[i]))
+        {
+          k = i;
+        }
+      }
+      if (k < 0)
+      {
+        now = next_arrival;
+        continue;
+      }
+      if (!is_shared(&queues[k]))
+      {
+        // Atencion exclusiva hasta terminar
+        running = heap_pop(ready[k]);
+        running_end = now + running->e->p->execution_time;
+      }
+    }
+
+    if (running != NULL)
+    {
+      if (running_end <= next_arrival)
+      {
+        now = running_end;
+        finish_item(running, now, blocking[running->queue]);
+        running = NULL;
+        finished++;
+      }
+      else
+      {
+        now = next_arrival;
+      }
+      continue;
+    }
+
+    // Procesador compartido entre los procesos listos de la cola k
+    it = heap_top(ready[k]);
+    if (ready[k]->count > it->max_ready)
+    {
+      it->max_ready = ready[k]->count;
+    }
+    completion = now + (it->key - vtime[k]) * ready[k]->count;
+    if (completion <= next_arrival)
+    {
+      vtime[k] = it->key;
+      now = completion;
+      heap_pop(ready[k]);
+      finish_item(it, now, (double)queues[k].quantum * it->max_ready + blocking[k]);
+      finished++;
+    }
+    else
+    {
+      vtime[k] += (next_arrival - now) / ready[k]->count;
+      now = next_arrival;
+    }
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    r->total_waiting += r->estimates[i].waiting_time;
+    r->total_turnaround += r->estimates[i].finished_time - r->estimates[i].p->arrival_time;
+    r->total_error += r->estimates[i].error_bound;
+  }
+
+  for (k = 0; k < nqueues; k++)
+  {
+    destroy_heap(ready[k], 0);
+  }
+  free(ready);
+  free(vtime);
+  free(blocking);
+  free(order);
+  free(items);
+
+  return r;
+}
+
+void print_fluid_result(fluid_result *r)
+{
+  int i;
+  fluid_estimate *e;
+  double n;
+
+  printf("Fluid approximation (processor sharing on RR queues, %d events)\n", r->events);
+  printf("%5s%20s%5s%9s%9s%9s\n", "#", "Process", "Arr.", "Fin.", "Wait", "+/-");
+  for (i = 0; i < r->count; i++)
+  {
+    e = &r->estimates[i];
+    printf("%5d%20s%5d%9.2f%9.2f%9.2f\n", i + 1, e->p->name, e->p->arrival_time,
+           e->finished_time, e->waiting_time, e->error_bound);
+  }
+
+  n = (r->count > 0) ? r->count : 1;
+  printf("\nTotal waiting time: %.3f Average waiting time: %.3f\n", r->total_waiting, r->total_waiting / n);
+  printf("Average turnaround time: %.3f\n", r->total_turnaround / n);
+  printf("Estimated error (average bound on finish time): %.3f\n", r->total_error / n);
+}
+
+void compare_fluid_result(fluid_result *r)
+{
+  int i;
+  int within;
+  fluid_estimate *e;
+  double diff;
+  double total_abs;
+  double max_abs;
+  double exact_total;
+  double n;
+
+  total_abs = 0;
+  max_abs = 0;
+  exact_total = 0;
+  within = 0;
+
+  printf("Fluid approximation vs exact simulation\n");
+  printf("%5s%20s%9s%9s%9s\n", "#", "Process", "Exact", "Fluid", "Diff");
+  for (i = 0; i < r->count; i++)
+  {
+    e = &r->estimates[i];
+    diff = e->waiting_time - e->p->waiting_time;
+    printf("%5d%20s%9d%9.2f%9.2f\n", i + 1, e->p->name, e->p->waiting_time, e->waiting_time, diff);
+    total_abs += fabs(diff);
+    if (fabs(diff) > max_abs)
+    {
+      max_abs = fabs(diff);
+    }
+    if (fabs(diff) <= e->error_bound)
+    {
+      within++;
+    }
+    exact_total += e->p->waiting_time;
+  }
+
+  n = (r->count > 0) ? r->count : 1;
+  printf("\nMean absolute error: %.3f Max absolute error: %.3f\n", total_abs / n, max_abs);
+  printf("Average waiting time: exact %.3f fluid %.3f (error %.3f)\n",
+         exact_total / n, r->total_waiting / n, (r->total_waiting - exact_total) / n);
+  printf("Processes within the estimated error: %d/%d\n", within, r->count);
+}
+
+void destroy_fluid_result(fluid_result *r)
+{
+  if (r == 0)
+  {
+    return;
+  }
+  free(r->estimates);
+  free(r);
+}
@@ -0,0 +1,67 @@
+#ifndef FLUID_H
+#define FLUID_H
+
+/**
+ * @file
+ * @brief Aproximacion de procesador compartido (fluida) para colas RR.
+ * @copyright MIT License
+ *
+ * En lugar de simular quantum por quantum, cada cola RR se trata como un
+ * procesador compartido entre eventos (llegadas y finalizaciones): los n
+ * procesos listos de la cola reciben cada uno 1/n de la CPU. Las colas que
+ * no son RR (o RR con quantum 0) atienden a sus procesos de forma exclusiva,
+ * igual que en la simulacion exacta.
+ */
+
+#include "list.h"
+#include "sched.h"
+
+/** @brief Resultado de la aproximacion para un proceso */
+typedef struct
+{
+  process *p;           /*!< Proceso estimado */
+  double finished_time; /*!< Tiempo de finalizacion estimado */
+  double waiting_time;  /*!< Tiempo de espera estimado */
+  double error_bound;   /*!< Error estimado del tiempo de finalizacion */
+} fluid_estimate;
+
+/** @brief Resultado de la aproximacion fluida */
+typedef struct
+{
+  int count;                 /*!< Cantidad de procesos */
+  fluid_estimate *estimates; /*!< Estimaciones, en el orden de la lista de procesos */
+  double total_waiting;      /*!< Tiempo total de espera estimado */
+  double total_turnaround;   /*!< Tiempo total de retorno estimado */
+  double total_error;        /*!< Suma de los errores estimados */
+  int events;                /*!< Cantidad de eventos procesados */
+} fluid_result;
+
+/**
+ * @brief Estima los tiempos de los procesos con la aproximacion fluida.
+ * @param processes Lista de procesos.
+ * @param queues Arreglo de colas de prioridad.
+ * @param nqueues Cantidad de colas de prioridad.
+ * @return Resultado de la aproximacion. Los procesos no se modifican.
+ */
+fluid_result *schedule_fluid(list *processes, priority_queue *queues, int nqueues);
+
+/**
+ * @brief Imprime el resultado de la aproximacion fluida.
+ * @param r Resultado a imprimir
+ */
+void print_fluid_result(fluid_result *r);
+
+/**
+ * @brief Compara la aproximacion con los tiempos de la simulacion exacta.
+ * @param r Resultado de la aproximacion
+ * @note Debe invocarse despues de schedule() sobre los mismos procesos.
+ */
+void compare_fluid_result(fluid_result *r);
+
+/**
+ * @brief Libera la memoria de un resultado de la aproximacion
+ * @param r Resultado a liberar
+ */
+void destroy_fluid_result(fluid_result *r);
+
+#endif
@@ -0,0 +1,371 @@
+/**
+ * @file
+ * @brief Generador de cargas sinteticas reproducibles para el simulador.
+ * @copyright MIT License
+ *
+ * Escribe en la salida estandar un archivo de configuracion con N procesos.
+ * Los parametros se pasan como clave=valor:
+ *  - n=N: cantidad de procesos (por defecto 1000).
+ *  - seed=S: semilla; la misma semilla produce el mismo archivo (por defecto 1).
+ *  - arrivals=poisson|bursty|diurnal: patron de llegadas (por defecto poisson).
+ *    - poisson: tiempos entre llegadas exponenciales con media 1/rate.
+ *    - bursty: rafagas de llegadas simultaneas, de tamano geometrico con media
+ *      batch, que llegan como un proceso de Poisson con tasa rate/batch.
+ *    - diurnal: Poisson con tasa rate * (1 + 0.8 sin(2 pi t / period)),
+ *      generado por adelgazamiento.
+ *  - rate=R: llegadas por unidad de tiempo (por defecto 0.5).
+ *  - batch=B: tamano medio de las rafagas de llegadas (por defecto 8).
+ *  - period=P: periodo del patron diurnal (por defecto 1000).
+ *  - bursts=exp|bimodal|pareto: distribucion del tiempo de CPU (por defecto exp).
+ *    - exp: exponencial con media mean.
+ *    - bimodal: 80% exponencial con media mean/2 y 20% con media 3*mean.
+ *    - pareto: cola pesada con forma alpha y media mean, truncada en 1000*mean.
+ *  - mean=M: tiempo medio de CPU (por defecto 10).
+ *  - alpha=A: forma de la distribucion de Pareto, mayor que 1 (por defecto 1.5).
+ *  - queues=ESTRATEGIA:PESO,...: colas de prioridad y proporcion de procesos
+ *    en cada una (por defecto fifo:1).
+ *  - quantum=Q: quantum de las colas que lo usan (por defecto 4).
+ *
+ * Ejemplo:
+ *  ./generator n=1000000 seed=7 arrivals=bursty bursts=pareto queues=rr:3,fifo:1 > big.txt
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "util.h"
+
+#ifndef M_PI
+/** @brief Pi, si math.h no lo define en modo C estricto */
+#define M_PI 3.14159265358979323846
+#endif
+
+/** @brief Cantidad maxima de colas de prioridad generadas */
+#define MAX_GEN_QUEUES 16
+
+/** @brief Parametros del generador */
+typedef struct
+{
+  long n;                           /*!< Cantidad de procesos */
+  unsigned long long seed;          /*!< Semilla */
+  const char *arrivals;             /*!< Patron de llegadas */
+  double rate;                      /*!< Llegadas por unidad de tiempo */
+  double batch;                     /*!< Tamano medio de las rafagas de llegadas (bursty) */
+  double period;                    /*!< Periodo del patron diurnal */
+  const char *bursts;               /*!< Distribucion del tiempo de CPU */
+  double mean;                      /*!< Tiempo medio de CPU */
+  double alpha;                     /*!< Forma de la distribucion de Pareto */
+  char strategies[MAX_GEN_QUEUES][16]; /*!< Estrategia de cada cola */
+  double weights[MAX_GEN_QUEUES];   /*!< Proporcion de procesos de cada cola */
+  int nqueues;                      /*!< Cantidad de colas */
+  int quantum;                      /*!< Quantum de las colas */
+} gen_config;
+
+/**
+ * @brief Numero uniforme en [0, 1)
+ * @param rng Estado del generador
+ * @return Numero con 53 bits aleatorios
+ */
+static double uniform(unsigned long long *rng)
+{
+  return (double)(next_random(rng) >> 11) / 9007199254740992.0;
+}
+
+/**
+ * @brief Numero con distribucion exponencial
+ * @param rng Estado del generador
+ * @param mean Media
+ * @return -mean * ln(1 - u)
+ */
+static double exponential(unsigned long long *rng, double mean)
+{
+  return -mean * log(1.0 - uniform(rng));
+}
+
+/**
+ * @brief Verifica si el simulador conoce una estrategia
+ * @param name Nombre de la estrategia en minusculas
+ * @return 1 si es una de las estrategias de DEFINE scheduling
+ */
+static int known_strategy(const char *name)
+{
+  static const char *names[] = {"fifo", "sjf", "rr", "srt", "cfs", "edf", "lottery", "stride", "cp"};
+  int i;
+
+  for (i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++)
+  {
+    if (equals(name, names[i]))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Lee la lista de colas ESTRATEGIA:PESO,...
+ * @param spec Lista de colas
+ * @param config Parametros que reciben las colas
+ * @return 1 si la lista es valida
+ */
+static int parse_queues(const char *spec, gen_config *config)
+{
+  const char *end;
+  const char *colon;
+  int len;
+
+  config->nqueues = 0;
+  while (*spec != 0)
+  {
+    if (config->nqueues == MAX_GEN_QUEUES)
+    {
+      return 0;
+    }
+    end = strchr(spec, ',');
+    if (end == NULL)
+    {
+      end = spec + strlen(spec);
+    }
+    colon = memchr(spec, ':', end - spec);
+    len = (int)(((colon != NULL) ? colon : end) - spec);
+    if (len == 0 || len >= (int)sizeof(config->strategies[0]))
+    {
+      return 0;
+    }
+    memcpy(config->strategies[config->nqueues], spec, len);
+    config->strategies[config->nqueues][len] = 0;
+    lcase(config->strategies[config->nqueues]);
+    config->weights[config->nqueues] = (colon != NULL) ? atof(colon + 1) : 1.0;
+    if (config->weights[config->nqueues] <= 0)
+    {
+      return 0;
+    }
+    config->nqueues++;
+    spec = (*end == ',') ? end + 1 : end;
+  }
+  return config->nqueues > 0;
+}
+
+/**
+ * @brief Sortea el tiempo de CPU de un proceso
+ * @param rng Estado del generador
+ * @param config Parametros del generador
+ * @return Tiempo de CPU, al menos 1
+ */
+static int next_burst(unsigned long long *rng, const gen_config *config)
+{
+  double x;
+  double xm;
+
+  if (equals(config->bursts, "bimodal"))
+  {
+    x = (uniform(rng) < 0.8) ? exponential(rng, config->mean / 2) : exponential(rng, config->mean * 3);
+  }
+  else if (equals(config->bursts, "pareto"))
+  {
+    // Escala tal que la media sea mean: xm * alpha / (alpha - 1)
+    xm = config->mean * (config->alpha - 1) / config->alpha;
+    x = xm / pow(1.0 - uniform(rng), 1.0 / config->alpha);
+    if (x > config->mean * 1000)
+    {
+      x = config->mean * 1000;
+    }
+  }
+  else
+  {
+    x = exponential(rng, config->mean);
+  }
+  x = floor(x + 0.5);
+  return (x < 1) ? 1 : (int)x;
+}
+
+/**
+ * @brief Sortea la cola de un proceso de acuerdo con los pesos
+ * @param rng Estado del generador
+ * @param config Parametros del generador
+ * @param total Suma de los pesos
+ * @return Cola, desde 1
+ */
+static int next_queue(unsigned long long *rng, const gen_config *config, double total)
+{
+  double x;
+  int i;
+
+  x = uniform(rng) * total;
+  for (i = 0; i < config->nqueues - 1; i++)
+  {
+    x -= config->weights[i];
+    if (x < 0)
+    {
+      break;
+    }
+  }
+  return i + 1;
+}
+
+/**
+ * @brief Programa principal del generador
+ * @param argc Cantidad de argumentos
+ * @param argv Parametros clave=valor
+ */
+int main(int argc, char *argv[])
+{
+  gen_config config;
+  unsigned long long rng;
+  double t;
+  double total;
+  double peak;
+  long pending;
+  long i;
+  int width;
+
+  config.n = 1000;
+  config.seed = 1;
+  config.arrivals = "poisson";
+  config.rate = 0.5;
+  config.batch = 8;
+  config.period = 1000;
+  config.bursts = "exp";
+  config.mean = 10;
+  config.alpha = 1.5;
+  config.quantum = 4;
+  parse_queues("fifo:1", &config);
+
+  for (i = 1; i < argc; i++)
+  {
+    if (strncmp(argv[i], "n=", 2) == 0)
+    {
+      config.n = atol(argv[i] + 2);
+    }
+    else if (strncmp(argv[i], "seed=", 5) == 0)
+    {
+      config.seed = strtoull(argv[i] + 5, 0, 10);
+    }
+    else if (strncmp(argv[i], "arrivals=", 9) == 0)
+    {
+      config.arrivals = argv[i] + 9;
+    }
+    else if (strncmp(argv[i], "rate=", 5) == 0)
+    {
+      config.rate = atof(argv[i] + 5);
+    }
+    else if (strncmp(argv[i], "batch=", 6) == 0)
+    {
+      config.batch = atof(argv[i] + 6);
+    }
+    else if (strncmp(argv[i], "period=", 7) == 0)
+    {
+      config.period = atof(argv[i] + 7);
+    }
+    else if (strncmp(argv[i], "bursts=", 7) == 0)
+    {
+      config.bursts = argv[i] + 7;
+    }
+    else if (strncmp(argv[i], "mean=", 5) == 0)
+    {
+      config.mean = atof(argv[i] + 5);
+    }
+    else if (strncmp(argv[i], "alpha=", 6) == 0)
+    {
+      config.alpha = atof(argv[i] + 6);
+    }
+    else if (strncmp(argv[i], "quantum=", 8) == 0)
+    {
+      config.quantum = atoi(argv[i] + 8);
+    }
+    else if (strncmp(argv[i], "queues=", 7) == 0)
+    {
+      if (!parse_queues(argv[i] + 7, &config))
+      {
+        fprintf(stderr, "Queues must be STRATEGY:WEIGHT,... with at most %d queues\n", MAX_GEN_QUEUES);
+        exit(EXIT_FAILURE);
+      }
+    }
+    else
+    {
+      fprintf(stderr, "Unknown parameter %s\n", argv[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  if (config.n < 1 || config.rate <= 0 || config.batch < 1 || config.period <= 0 || config.mean < 1 ||
+      config.alpha <= 1)
+  {
+    fprintf(stderr, "n, rate, period, mean and batch must be positive, batch and mean at least 1, alpha greater than 1\n");
+    exit(EXIT_FAILURE);
+  }
+  if (!equals(config.arrivals, "poisson") && !equals(config.arrivals, "bursty") && !equals(config.arrivals, "diurnal"))
+  {
+    fprintf(stderr, "Unknown arrival pattern %s\n", config.arrivals);
+    exit(EXIT_FAILURE);
+  }
+  if (!equals(config.bursts, "exp") && !equals(config.bursts, "bimodal") && !equals(config.bursts, "pareto"))
+  {
+    fprintf(stderr, "Unknown burst distribution %s\n", config.bursts);
+    exit(EXIT_FAILURE);
+  }
+  for (i = 0; i < config.nqueues; i++)
+  {
+    if (!known_strategy(config.strategies[i]))
+    {
+      fprintf(stderr, "Unknown strategy %s\n", config.strategies[i]);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  // Encabezado: colas y estrategias
+  printf("#Generated: n=%ld seed=%llu arrivals=%s rate=%g bursts=%s mean=%g\n", config.n, config.seed,
+         config.arrivals, config.rate, config.bursts, config.mean);
+  printf("DEFINE queues %d\n", config.nqueues);
+  total = 0;
+  for (i = 0; i < config.nqueues; i++)
+  {
+    printf("DEFINE scheduling %ld %s\n", i + 1, config.strategies[i]);
+    printf("DEFINE quantum %ld %d\n", i + 1, config.quantum);
+    total += config.weights[i];
+  }
+
+  // Nombres de igual longitud, de modo que el orden por nombre es el orden de llegada
+  width = 1;
+  for (i = config.n; i >= 10; i /= 10)
+  {
+    width++;
+  }
+
+  rng = config.seed;
+  t = 0;
+  pending = 0;
+  peak = config.rate * 1.8;
+  for (i = 0; i < config.n; i++)
+  {
+    if (equals(config.arrivals, "bursty"))
+    {
+      // Una nueva rafaga de tamano geometrico llega despues de un tiempo exponencial
+      if (pending == 0)
+      {
+        t += exponential(&rng, config.batch / config.rate);
+        pending = 1 + (long)floor(log(1.0 - uniform(&rng)) / log(1.0 - 1.0 / config.batch));
+      }
+      pending--;
+    }
+    else if (equals(config.arrivals, "diurnal"))
+    {
+      // Adelgazamiento: candidatos con la tasa maxima, aceptados con rate(t) / maxima
+      do
+      {
+        t += exponential(&rng, 1.0 / peak);
+      } while (uniform(&rng) * peak > config.rate * (1 + 0.8 * sin(2 * M_PI * t / config.period)));
+    }
+    else
+    {
+      t += exponential(&rng, 1.0 / config.rate);
+    }
+    printf("PROCESS p%0*ld %ld %d %d\n", width, i + 1, (long)t, next_burst(&rng, &config),
+           next_queue(&rng, &config, total));
+  }
+  printf("START\n");
+
+  return 0;
+}
@@ -0,0 +1,199 @@
+/**
+ * @file
+ * @brief Monticulo binario (cola de prioridad generica)
+ * @copyright MIT License
+ */
+
+#include <stdlib.h>
+#include "heap.h"
+
+/** @brief Capacidad inicial de un monticulo */
+#define HEAP_INITIAL_CAPACITY 16
+
+heap *create_heap(int (*compare)(void *const, void *const))
+{
+   heap *ret;
+
+   ret = (heap *)malloc(sizeof(heap));
+
+   ret->capacity = HEAP_INITIAL_CAPACITY;
+   ret->data = (void **)malloc(sizeof(void *) * ret->capacity);
+   ret->count = 0;
+   ret->compare = compare;
+   return ret;
+}
+
+void destroy_heap(heap *h, int erase_data)
+{
+   int i;
+
+   if (h == 0)
+   {
+      return;
+   }
+   if (erase_data)
+   {
+      for (i = 0; i < h->count; i++)
+      {
+         free(h->data[i]);
+      }
+   }
+   free(h->data);
+   free(h);
+}
+
+/**
+ * @brief Sube un dato desde la posicion i mientras tenga prioridad sobre su padre
+ * @param h Monticulo
+ * @param i Posicion libre de la cual se parte
+ * @param data Dato a ubicar
+ */
+static void sift_up(heap *h, int i, void *data)
+{
+   int parent;
+
+   while (i > 0)
+   {
+      parent = (i - 1) / 2;
+      if (h->compare(data, h->data[parent]) <= 0)
+      {
+         break;
+      }
+      h->data[i] = h->data[parent];
+      i = parent;
+   }
+   h->data[i] = data;
+}
+
+/**
+ * @brief Baja un dato desde la posicion i mientras alguno de sus hijos tenga prioridad
+ * @param h Monticulo
+ * @param i Posicion libre de la cual se parte
+ * @param data Dato a ubicar
+ */
+static void sift_down(heap *h, int i, void *data)
+{
+   int child;
+
+   while ((child = 2 * i + 1) < h->count)
+   {
+      if (child + 1 < h->count && h->compare(h->data[child + 1], h->data[child]) > 0)
+      {
+         child++;
+      }
+      if (h->compare(h->data[child], data) <= 0)
+      {
+         break;
+      }
+      h->data[i] = h->data[child];
+      i = child;
+   }
+   h->data[i] = data;
+}
+
+heap *heap_push(heap *h, void *data)
+{
+   if (h == 0)
+   {
+      return 0;
+   }
+
+   if (h->count == h->capacity)
+   {
+      h->capacity *= 2;
+      h->data = (void **)realloc(h->data, sizeof(void *) * h->capacity);
+   }
+
+   sift_up(h, h->count++, data);
+
+   return h;
+}
+
+void *heap_top(const heap *h)
+{
+   if (h == 0 || h->count == 0)
+   {
+      return 0;
+   }
+   return h->data[0];
+}
+
+void *heap_pop(heap *h)
+{
+   void *ret;
+   void *last;
+
+   if (h == 0 || h->count == 0)
+   {
+      return 0;
+   }
+
+   ret = h->data[0];
+   last = h->data[--h->count];
+
+   // Bajar el ultimo dato desde la raiz hasta su posicion
+   if (h->count > 0)
+   {
+      sift_down(h, 0, last);
+   }
+
+   return ret;
+}
+
+int heap_remove(heap *h, void *data)
+{
+   void *last;
+   int i;
+
+   if (h == 0)
+   {
+      return 0;
+   }
+
+   for (i = 0; i < h->count && h->data[i] != data; i++)
+      ;
+
+   if (i == h->count)
+   {
+      return 0;
+   }
+
+   // El ultimo dato ocupa la posicion liberada, y sube o baja segun su prioridad
+   last = h->data[--h->count];
+   if (i < h->count)
+   {
+      if (i > 0 && h->compare(last, h->data[(i - 1) / 2]) > 0)
+      {
+         sift_up(h, i, last);
+      }
+      else
+      {
+         sift_down(h, i, last);
+      }
+   }
+
+   return 1;
+}
+
+void clear_heap(heap *h, int erase_data)
+{
+   int i;
+
+   if (h == 0)
+   {
+      return;
+   }
+   if (erase_data)
+   {
+      for (i = 0; i < h->count; i++)
+      {
+         free(h->data[i]);
+      }
+   }
+   h->count = 0;
+}
+
+int heap_empty(const heap *h)
+{
+   return ((h == 0) || h->count == 0);
+}
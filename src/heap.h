@@ -0,0 +1,81 @@
+/**
+ * @file
+ * @brief Monticulo binario (cola de prioridad generica)
+ * @copyright MIT License
+ */
+
+#ifndef _HEAP_H
+#define _HEAP_H
+
+/**
+ * @brief Monticulo binario de apuntadores.
+ * @note La funcion de comparacion sigue el mismo criterio de insert_ordered:
+ * compare(a, b) > 0 indica que a debe salir antes que b.
+ */
+typedef struct
+{
+       void **data;                               /*!< Arreglo de datos */
+       int count;                                 /*!< Cantidad de elementos */
+       int capacity;                              /*!< Capacidad del arreglo */
+       int (*compare)(void *const, void *const); /*!< Funcion de comparacion */
+} heap;
+
+/**
+ * @brief Crea un nuevo monticulo vacio.
+ * @param compare Funcion de comparacion similar a strcmp
+ * @return Nuevo monticulo vacio.
+ */
+heap *create_heap(int (*compare)(void *const, void *const));
+
+/**
+ * @brief Libera la memoria asignada a un monticulo
+ * @param h Monticulo
+ * @param erase_data Libera tambien los datos
+ */
+void destroy_heap(heap *h, int erase_data);
+
+/**
+ * @brief Inserta un nuevo dato en el monticulo
+ * @param h Monticulo que recibe el nuevo dato
+ * @param data Apuntador al nuevo dato
+ * @return Monticulo modificado
+ */
+heap *heap_push(heap *h, void *data);
+
+/**
+ * @brief Obtiene el dato con mayor prioridad, sin retirarlo
+ * @param h Monticulo
+ * @return Dato con mayor prioridad, 0 si el monticulo se encuentra vacio.
+ */
+void *heap_top(const heap *h);
+
+/**
+ * @brief Retira el dato con mayor prioridad
+ * @param h Monticulo
+ * @return Dato retirado, 0 si el monticulo se encuentra vacio.
+ */
+void *heap_pop(heap *h);
+
+/**
+ * @brief Retira un dato cualquiera del monticulo, en O(n)
+ * @param h Monticulo
+ * @param data Dato a retirar (se compara el apuntador)
+ * @return 1 si el dato se encontraba en el monticulo, 0 en caso contrario
+ */
+int heap_remove(heap *h, void *data);
+
+/**
+ * @brief Retira todos los datos del monticulo
+ * @param h Monticulo a limpiar
+ * @param erase_data 1 = libera tambien los datos
+ */
+void clear_heap(heap *h, int erase_data);
+
+/**
+ * @brief Verifica si un monticulo se encuentra vacio
+ * @param h Monticulo a verificar
+ * @return 1 = monticulo vacio, 0 en caso contrario
+ */
+int heap_empty(const heap *h);
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file
+ * @brief Histogramas de latencia de memoria fija y sus percentiles.
+ * @copyright MIT License
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "latency.h"
+
+/**
+ * @brief Cubeta de un valor
+ * @param value Valor no negativo
+ * @return Indice de la cubeta
+ */
+static int bucket_of(int value)
+{
+  int shift;
+
+  if (value < 2 * HISTOGRAM_HALF)
+  {
+    return value;
+  }
+  // shift = posicion del bit mas significativo - HISTOGRAM_BITS; value >> shift queda en [HALF, 2 HALF)
+  shift = 1;
+  while ((value >> shift) >= 2 * HISTOGRAM_HALF)
+  {
+    shift++;
+  }
+  return shift * HISTOGRAM_HALF + (value >> shift);
+}
+
+/**
+ * @brief Mayor valor que cae en una cubeta
+ * @param bucket Indice de la cubeta
+ * @return Valor
+ */
+static int bucket_high(int bucket)
+{
+  int shift;
+
+  if (bucket < 2 * HISTOGRAM_HALF)
+  {
+    return bucket;
+  }
+  shift = bucket / HISTOGRAM_HALF - 1;
+  return (int)(((long)(bucket - shift * HISTOGRAM_HALF + 1) << shift) - 1);
+}
+
+void histogram_reset(histogram *h)
+{
+  memset(h, 0, sizeof(histogram));
+}
+
+void histogram_record(histogram *h, int value)
+{
+  if (value < 0)
+  {
+    value = 0;
+  }
+  if (h->count == 0 || value < h->min)
+  {
+    h->min = value;
+  }
+  if (h->count == 0 || value > h->max)
+  {
+    h->max = value;
+  }
+  h->counts[bucket_of(value)]++;
+  h->count++;
+  h->sum += value;
+}
+
+void histogram_merge(histogram *to, const histogram *from)
+{
+  int i;
+
+  if (from->count == 0)
+  {
+    return;
+  }
+  if (to->count == 0 || from->min < to->min)
+  {
+    to->min = from->min;
+  }
+  if (to->count == 0 || from->max > to->max)
+  {
+    to->max = from->max;
+  }
+  for (i = 0; i < HISTOGRAM_BUCKETS; i++)
+  {
+    to->counts[i] += from->counts[i];
+  }
+  to->count += from->count;
+  to->sum += from->sum;
+}
+
+int histogram_percentile(const histogram *h, double percentile)
+{
+  long rank;
+  long seen;
+  int i;
+
+  if (h->count == 0)
+  {
+    return 0;
+  }
+  // Rango del valor mas cercano: el menor valor con al menos percentile% de los valores <= el
+  rank = (long)ceil(percentile / 100.0 * h->count);
+  if (rank < 1)
+  {
+    rank = 1;
+  }
+  seen = 0;
+  for (i = 0; i < HISTOGRAM_BUCKETS; i++)
+  {
+    seen += h->counts[i];
+    if (seen >= rank)
+    {
+      break;
+    }
+  }
+  return min(max(bucket_high(i), h->min), h->max);
+}
+
+latency_histograms *create_latencies(void)
+{
+  return (latency_histograms *)calloc(1, sizeof(latency_histograms));
+}
+
+void reset_latencies(latency_histograms *l)
+{
+  histogram_reset(&l->wait);
+  histogram_reset(&l->response);
+  histogram_reset(&l->turnaround);
+}
+
+void record_latencies(latency_histograms *l, process *p)
+{
+  // released es la llegada, o el fin del ultimo predecesor si es posterior
+  histogram_record(&l->wait, p->waiting_time);
+  histogram_record(&l->response, p->first_run - p->released);
+  histogram_record(&l->turnaround, p->finished_time - p->released);
+}
+
+/**
+ * @brief Imprime los percentiles de un histograma
+ * @param name Nombre de la metrica
+ * @param h Histograma
+ */
+static void print_histogram(const char *name, const histogram *h)
+{
+  printf("%-11s %7d %7d %7d %7d %7d %10.3f\n", name, histogram_percentile(h, 50),
+         histogram_percentile(h, 90), histogram_percentile(h, 99), histogram_percentile(h, 99.9), h->max,
+         (double)h->sum / h->count);
+}
+
+/**
+ * @brief Imprime los percentiles de las tres latencias
+ * @param title Titulo: cola o total
+ * @param l Histogramas
+ */
+static void print_latencies(const char *title, const latency_histograms *l)
+{
+  printf("%s (%ld processes)\n", title, l->turnaround.count);
+  print_histogram("Wait", &l->wait);
+  print_histogram("Response", &l->response);
+  print_histogram("Turnaround", &l->turnaround);
+}
+
+void print_latency_report(priority_queue *queues, int nqueues)
+{
+  latency_histograms *total;
+  char title[32];
+  int i;
+
+  total = create_latencies();
+  for (i = 0; i < nqueues; i++)
+  {
+    histogram_merge(&total->wait, &queues[i].latencies->wait);
+    histogram_merge(&total->response, &queues[i].latencies->response);
+    histogram_merge(&total->turnaround, &queues[i].latencies->turnaround);
+  }
+  if (total->turnaround.count == 0)
+  {
+    free(total);
+    return;
+  }
+
+  printf("\nLatency percentiles (error < %.1f%% above %d)\n", 100.0 / HISTOGRAM_HALF, 2 * HISTOGRAM_HALF);
+  printf("%-11s %7s %7s %7s %7s %7s %10s\n", "", "p50", "p90", "p99", "p99.9", "max", "mean");
+  // Con una sola cola el total es igual a la cola
+  if (nqueues > 1)
+  {
+    for (i = 0; i < nqueues; i++)
+    {
+      if (queues[i].latencies->turnaround.count > 0)
+      {
+        snprintf(title, sizeof(title), "Queue %d", i + 1);
+        print_latencies(title, queues[i].latencies);
+      }
+    }
+  }
+  print_latencies("All queues", total);
+  free(total);
+}
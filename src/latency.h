@@ -0,0 +1,102 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+/**
+ * @file
+ * @brief Histogramas de latencia de memoria fija y sus percentiles.
+ * @copyright MIT License
+ *
+ * Los histogramas son log-lineales, como HdrHistogram: los valores menores
+ * que 2 * HISTOGRAM_HALF tienen una cubeta cada uno, y cada potencia de dos
+ * mayor se divide en HISTOGRAM_HALF cubetas. El error relativo de un
+ * percentil es menor que 1 / HISTOGRAM_HALF, y la memoria no depende de la
+ * cantidad de procesos. Cada cola registra el tiempo de espera, de respuesta
+ * (hasta la primera asignacion de la CPU) y de retorno de sus procesos al
+ * terminar; los histogramas totales se obtienen sumando las cubetas de las
+ * colas.
+ */
+
+#include "sched.h"
+
+/** @brief Bits de precision de los histogramas */
+#define HISTOGRAM_BITS 6
+
+/** @brief Cubetas por cada potencia de dos */
+#define HISTOGRAM_HALF (1 << HISTOGRAM_BITS)
+
+/** @brief Cubetas necesarias para cualquier valor int no negativo */
+#define HISTOGRAM_BUCKETS ((32 - HISTOGRAM_BITS) * HISTOGRAM_HALF)
+
+/** @brief Histograma log-lineal de valores enteros no negativos */
+typedef struct
+{
+  long counts[HISTOGRAM_BUCKETS]; /*!< Valores registrados en cada cubeta */
+  long count;                     /*!< Cantidad de valores */
+  long long sum;                  /*!< Suma de los valores, para la media */
+  int min;                        /*!< Menor valor registrado */
+  int max;                        /*!< Mayor valor registrado */
+} histogram;
+
+/** @brief Histogramas de latencia de una cola de prioridad */
+typedef struct latency_histograms
+{
+  histogram wait;       /*!< Tiempo de espera en las colas de listos */
+  histogram response;   /*!< Tiempo desde la llegada hasta la primera asignacion de la CPU */
+  histogram turnaround; /*!< Tiempo desde la llegada hasta el fin */
+} latency_histograms;
+
+/**
+ * @brief Vacia un histograma
+ * @param h Histograma
+ */
+void histogram_reset(histogram *h);
+
+/**
+ * @brief Registra un valor en O(log v)
+ * @param h Histograma
+ * @param value Valor; los negativos se registran como 0
+ */
+void histogram_record(histogram *h, int value);
+
+/**
+ * @brief Suma las cubetas de un histograma a otro
+ * @param to Histograma que recibe los valores
+ * @param from Histograma sumado
+ */
+void histogram_merge(histogram *to, const histogram *from);
+
+/**
+ * @brief Obtiene un percentil
+ * @param h Histograma
+ * @param percentile Percentil, entre 0 y 100
+ * @return Mayor valor de la cubeta que contiene el percentil, sin superar el maximo registrado
+ */
+int histogram_percentile(const histogram *h, double percentile);
+
+/**
+ * @brief Crea los histogramas de latencia de una cola, vacios
+ * @return Histogramas
+ */
+latency_histograms *create_latencies(void);
+
+/**
+ * @brief Vacia los histogramas de latencia de una cola
+ * @param l Histogramas
+ */
+void reset_latencies(latency_histograms *l);
+
+/**
+ * @brief Registra las latencias de un proceso que termina
+ * @param l Histogramas de la cola en la que termina
+ * @param p Proceso terminado
+ */
+void record_latencies(latency_histograms *l, process *p);
+
+/**
+ * @brief Imprime los percentiles de cada cola y del total
+ * @param queues Arreglo de colas de prioridad
+ * @param nqueues Cantidad de colas de prioridad
+ */
+void print_latency_report(priority_queue *queues, int nqueues);
+
+#endif
@@ -1,314 +1,439 @@
-/**
- * @file
- * @brief Funciones de listas enlazadas
- * @author  Erwin Meza Vega <emezav@gmail.com>
- * @copyright MIT License
- */
-
-#include <stdlib.h>
-#include "list.h"
-
-list *create_list()
-{
-   list *ret;
-
-   ret = (list *)malloc(sizeof(list));
-
-   ret->head = 0;
-   ret->tail = 0;
-   ret->count = 0;
-   return ret;
-}
-
-node *
-create_node(void *data)
-{
-   node *ret;
-
-   ret = (node *)malloc(sizeof(node));
-   ret->data = data;
-   ret->next = 0;
-   ret->previous = 0;
-
-   return ret;
-}
-
-void clear_list(list *l, int erase_data)
-{
-   if (l == 0)
-   {
-      return;
-   }
-   node *aux, *ptr;
-
-   ptr = l->head;
-
-   // printf("Clearing list...\n");
-   while (ptr != 0)
-   {
-      aux = ptr;
-      ptr = ptr->next;
-      if (erase_data)
-      {
-         free(aux->data);
-      }
-      free(aux);
-      aux = NULL;
-   }
-
-   // printf("Finished clearing list\n");
-
-   l->head = 0;
-   l->tail = 0;
-   l->count = 0;
-}
-
-void destroy_list(list *l, int erase_data)
-{
-   clear_list(l, erase_data);
-   free(l);
-}
-
-list *insert_ordered(list *l, void *data,
-                     int (*compare)(void *const, void *const))
-{
-
-   node *n;
-   node *aux, *ant;
-   if (l == 0)
-   {
-      return 0;
-   }
-   n = create_node(data);
-
-   if (l->head == 0)
-   { /*Primer elemento en la lista  */
-      l->head = n;
-      l->tail = n;
-      l->count = 0;
-   }
-   else
-   {
-      ant = 0;
-      aux = l->head;
-      while (aux != 0 && compare(data, aux->data) <= 0)
-      {
-         ant = aux;
-         aux = aux->next;
-      }
-
-      n->previous = ant;
-
-      if (ant == 0)
-      { // Primer nodo de la lista
-         n->next = l->head;
-         l->head->previous = n;
-         l->head = n;
-      }
-      else
-      {
-         ant->next = n;
-         n->next = aux;
-         if (aux == 0)
-         { // Final de la lista
-            l->tail = n;
-         }
-         else
-         {
-            aux->previous = n;
-         }
-      }
-   }
-
-   l->count++;
-
-   return l;
-}
-
-list *push_front(list *l, void *data)
-{
-   node *n;
-
-   if (l == 0)
-   {
-      return 0;
-   }
-
-   n = create_node(data);
-
-   if (l->head == 0)
-   { /*Primer elemento en la lista  */
-      l->head = n;
-      l->tail = n;
-      l->count = 0;
-   }
-   else
-   {
-      n->next = l->head;
-      l->head->previous = n;
-      l->head = n;
-   }
-
-   l->count++;
-
-   return l;
-}
-
-list *push_back(list *l, void *data)
-{
-   node *n;
-
-   if (l == 0)
-   {
-      return 0;
-   }
-
-   n = create_node(data);
-
-   if (l->tail == 0)
-   { /*Primer elemento en la lista */
-      l->head = n;
-      l->tail = n;
-      l->count = 0;
-   }
-   else
-   {
-      n->previous = l->tail;
-      l->tail->next = n;
-      l->tail = n;
-   }
-   l->count++;
-
-   return l;
-}
-
-void *front(const list *l)
-{
-   if (l == 0)
-   {
-      return 0;
-   }
-   if (l->head == 0)
-   {
-      return 0;
-   }
-   return l->head->data;
-}
-
-void *back(list *l)
-{
-   if (l == 0)
-   {
-      return 0;
-   }
-   if (l->tail == 0)
-   {
-      return 0;
-   }
-   return l->tail->data;
-}
-
-list *pop_front(list *l)
-{
-   node *ret;
-   void *data;
-
-   if (l == 0 || l->count == 0)
-   {
-      return l;
-   }
-
-   ret = l->head;
-
-   l->head = l->head->next;
-
-   if (l->head == 0)
-   {
-      l->tail = 0;
-   }
-   else
-   {
-      l->head->previous = 0;
-   }
-
-   l->count--;
-
-   data = ret->data;
-
-   free(ret);
-
-   return l;
-}
-
-list *pop_back(list *l)
-{
-   node *ret;
-   void *data;
-
-   if (l == 0 || l->count == 0)
-   {
-      return l;
-   }
-
-   ret = l->tail;
-
-   l->tail = l->tail->previous;
-
-   if (l->tail == 0)
-   { /* Un solo elemento? */
-      l->head = 0;
-   }
-   else
-   {
-      l->tail->next = 0;
-   }
-
-   l->count--;
-
-   data = ret->data;
-
-   free(ret);
-
-   return l;
-}
-
-int empty(list *l)
-{
-   return ((l == 0) || l->head == 0);
-}
-
-node_iterator head(list *l)
-{
-   if (l == 0)
-   {
-      return 0;
-   }
-   return l->head;
-}
-
-node_iterator tail(list *l)
-{
-   if (l == 0)
-   {
-      return 0;
-   }
-   return l->tail;
-}
-
-node_iterator next(node_iterator it)
-{
-   if (it == 0)
-   {
-      return 0;
-   }
-   return it->next;
-}
-
-node_iterator previous(node_iterator it)
-{
-   if (it == 0)
-   {
-      return 0;
-   }
-   return it->previous;
+/**
+ * @file
+ * @brief Funciones de listas enlazadas
+ * @author  Erwin Meza Vega <emezav@gmail.com>
+ * @copyright MIT License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "list.h"
+
+list *create_list()
+{
+   list *ret;
+
+   ret = (list *)malloc(sizeof(list));
+
+   ret->head = 0;
+   ret->tail = 0;
+   ret->count = 0;
+   return ret;
+}
+
+node *
+create_node(void *data)
+{
+   node *ret;
+
+   ret = (node *)malloc(sizeof(node));
+   ret->data = data;
+   ret->next = 0;
+   ret->previous = 0;
+
+   return ret;
+}
+
+void clear_list(list *l, int erase_data)
+{
+   if (l == 0)
+   {
+      return;
+   }
+   node *aux, *ptr;
+
+   ptr = l->head;
+
+   // printf("Clearing list...\n");
+   while (ptr != 0)
+   {
+      aux = ptr;
+      ptr = ptr->next;
+      if (erase_data)
+      {
+         free(aux->data);
+      }
+      free(aux);
+      aux = NULL;
+   }
+
+   // printf("Finished clearing list\n");
+
+   l->head = 0;
+   l->tail = 0;
+   l->count = 0;
+}
+
+void destroy_list(list *l, int erase_data)
+{
+   clear_list(l, erase_data);
+   free(l);
+}
+
+list *insert_ordered(list *l, void *data,
+                     int (*compare)(void *const, void *const))
+{
+
+   node *n;
+   node *aux, *ant;
+   if (l == 0)
+   {
+      return 0;
+   }
+   n = create_node(data);
+
+   if (l->head == 0)
+   { /*Primer elemento en la lista  */
+      l->head = n;
+      l->tail = n;
+      l->count = 0;
+   }
+   else
+   {
+      ant = 0;
+      aux = l->head;
+      while (aux != 0 && compare(data, aux->data) <= 0)
+      {
+         ant = aux;
+         aux = aux->next;
+      }
+
+      n->previous = ant;
+
+      if (ant == 0)
+      { // Primer nodo de la lista
+         n->next = l->head;
+         l->head->previous = n;
+         l->head = n;
+      }
+      else
+      {
+         ant->next = n;
+         n->next = aux;
+         if (aux == 0)
+         { // Final de la lista
+            l->tail = n;
+         }
+         else
+         {
+            aux->previous = n;
+         }
+      }
+   }
+
+   l->count++;
+
+   return l;
+}
+
+/**
+ * @brief Mezcla dos cadenas de nodos ordenadas, enlazadas por next
+ * @param a Primera cadena, sus nodos van primero si son iguales
+ * @param b Segunda cadena
+ * @param compare Funcion de comparacion similar a strcmp
+ * @return Primer nodo de la cadena mezclada
+ */
+static node *merge_nodes(node *a, node *b, int (*compare)(void *const, void *const))
+{
+   node first;
+   node *last;
+
+   last = &first;
+   while (a != 0 && b != 0)
+   {
+      // Igual que insert_ordered: b solo pasa adelante si compare(b, a) > 0
+      if (compare(b->data, a->data) > 0)
+      {
+         last->next = b;
+         b = b->next;
+      }
+      else
+      {
+         last->next = a;
+         a = a->next;
+      }
+      last = last->next;
+   }
+   last->next = (a != 0) ? a : b;
+   return first.next;
+}
+
+list *sort_list(list *l, int (*compare)(void *const, void *const))
+{
+   node *runs[64];
+   node *run;
+   node *n;
+   node *aux;
+   int i;
+
+   if (l == 0 || l->head == 0)
+   {
+      return l;
+   }
+
+   // Mezcla ascendente: runs[i] es una cadena ordenada de 2^i nodos
+   memset(runs, 0, sizeof(runs));
+   n = l->head;
+   while (n != 0)
+   {
+      run = n;
+      n = n->next;
+      run->next = 0;
+      for (i = 0; runs[i] != 0; i++)
+      {
+         run = merge_nodes(runs[i], run, compare);
+         runs[i] = 0;
+      }
+      runs[i] = run;
+   }
+   run = 0;
+   for (i = 0; i < 64; i++)
+   {
+      if (runs[i] != 0)
+      {
+         run = (run == 0) ? runs[i] : merge_nodes(runs[i], run, compare);
+      }
+   }
+
+   // Reconstruir los enlaces al nodo anterior
+   l->head = run;
+   aux = 0;
+   for (n = run; n != 0; n = n->next)
+   {
+      n->previous = aux;
+      aux = n;
+   }
+   l->tail = aux;
+
+   return l;
+}
+
+list *push_front(list *l, void *data)
+{
+   node *n;
+
+   if (l == 0)
+   {
+      return 0;
+   }
+
+   n = create_node(data);
+
+   if (l->head == 0)
+   { /*Primer elemento en la lista  */
+      l->head = n;
+      l->tail = n;
+      l->count = 0;
+   }
+   else
+   {
+      n->next = l->head;
+      l->head->previous = n;
+      l->head = n;
+   }
+
+   l->count++;
+
+   return l;
+}
+
+list *push_back(list *l, void *data)
+{
+   node *n;
+
+   if (l == 0)
+   {
+      return 0;
+   }
+
+   n = create_node(data);
+
+   if (l->tail == 0)
+   { /*Primer elemento en la lista */
+      l->head = n;
+      l->tail = n;
+      l->count = 0;
+   }
+   else
+   {
+      n->previous = l->tail;
+      l->tail->next = n;
+      l->tail = n;
+   }
+   l->count++;
+
+   return l;
+}
+
+void *front(const list *l)
+{
+   if (l == 0)
+   {
+      return 0;
+   }
+   if (l->head == 0)
+   {
+      return 0;
+   }
+   return l->head->data;
+}
+
+void *back(list *l)
+{
+   if (l == 0)
+   {
+      return 0;
+   }
+   if (l->tail == 0)
+   {
+      return 0;
+   }
+   return l->tail->data;
+}
+
+list *pop_front(list *l)
+{
+   node *ret;
+   void *data;
+
+   if (l == 0 || l->count == 0)
+   {
+      return l;
+   }
+
+   ret = l->head;
+
+   l->head = l->head->next;
+
+   if (l->head == 0)
+   {
+      l->tail = 0;
+   }
+   else
+   {
+      l->head->previous = 0;
+   }
+
+   l->count--;
+
+   data = ret->data;
+
+   free(ret);
+
+   return l;
+}
+
+list *pop_back(list *l)
+{
+   node *ret;
+   void *data;
+
+   if (l == 0 || l->count == 0)
+   {
+      return l;
+   }
+
+   ret = l->tail;
+
+   l->tail = l->tail->previous;
+
+   if (l->tail == 0)
+   { /* Un solo elemento? */
+      l->head = 0;
+   }
+   else
+   {
+      l->tail->next = 0;
+   }
+
+   l->count--;
+
+   data = ret->data;
+
+   free(ret);
+
+   return l;
+}
+
+list *remove_data(list *l, void *data)
+{
+   node *n;
+
+   if (l == 0)
+   {
+      return l;
+   }
+
+   for (n = l->head; n != 0 && n->data != data; n = n->next)
+      ;
+
+   if (n == 0)
+   {
+      return l;
+   }
+
+   if (n->previous == 0)
+   {
+      l->head = n->next;
+   }
+   else
+   {
+      n->previous->next = n->next;
+   }
+
+   if (n->next == 0)
+   {
+      l->tail = n->previous;
+   }
+   else
+   {
+      n->next->previous = n->previous;
+   }
+
+   l->count--;
+
+   free(n);
+
+   return l;
+}
+
+int empty(list *l)
+{
+   return ((l == 0) || l->head == 0);
+}
+
+node_iterator head(list *l)
+{
+   if (l == 0)
+   {
+      return 0;
+   }
+   return l->head;
+}
+
+node_iterator tail(list *l)
+{
+   if (l == 0)
+   {
+      return 0;
+   }
+   return l->tail;
+}
+
+node_iterator next(node_iterator it)
+{
+   if (it == 0)
+   {
+      return 0;
+   }
+   return it->next;
+}
+
+node_iterator previous(node_iterator it)
+{
+   if (it == 0)
+   {
+      return 0;
+   }
+   return it->previous;
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
  * Ejecucion:
  *  ./main archivo_configuracion
  *  ./main < archivo_configuracion
+ *  ./main --stats archivo_configuracion (contadores y tiempos, ver stats.h)
  * Ejemplos (Linux/bash):
  *  ./main test/fifo.txt
  *  ./main test/rr.txt
@@ -30,10 +31,17 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "cgroup.h"
+#include "client.h"
+#include "dag.h"
+#include "fluid.h"
 #include "list.h"
 #include "plot.h"
+#include "policy.h"
 #include "sched.h"
 #include "split.h"
+#include "stats.h"
+#include "sweep.h"
 #include "util.h"
 
 /** @brief Nombre por defecto de la grafica de simulacion. */
@@ -45,7 +53,36 @@
  * @param b Proceso 2
  * @return strcmp(p2->name, p1->name)
  */
-int compare_process_name(const void *a, const void *b);
+int compare_process_name(void *const a, void *const b);
+
+/**
+ * @brief Advierte sobre lo que no modelan las aproximaciones
+ * @param queues Arreglo de colas de prioridad
+ * @param nqueues Cantidad de colas de prioridad
+ * @param config Parametros de la simulacion
+ * @param io 1 si algun proceso tiene rafagas de E/S
+ * @param cgroups Cantidad de grupos de control
+ * @param dependencies Cantidad de dependencias entre procesos
+ */
+void warn_unsupported(priority_queue *queues, int nqueues, const sched_config *config, int io, int cgroups,
+                      int dependencies);
+
+/**
+ * @brief Agrega las dependencias de los procesos creados por una linea PROCESS
+ * @param table Tabla de procesos
+ * @param spec Nombres de los predecesores separados por comas (ej. a,b); el nombre de un grupo incluye todos sus hilos
+ * @param first Indice del primer proceso creado por la linea; los predecesores deben estar antes
+ * @return Cantidad de dependencias agregadas
+ */
+int parse_dependencies(process_table *table, const char *spec, int first);
+
+/**
+ * @brief Lee una lista de rafagas separadas por comas
+ * @param spec Rafagas alternas de CPU y E/S (ej. 5,3,4)
+ * @param bursts Arreglo de rafagas leidas, NULL si solo hay una rafaga
+ * @return Cantidad de rafagas, 0 si alguna rafaga no es mayor que cero
+ */
+int parse_bursts(const char *spec, int **bursts);
 
 /**
  * @brief Programa principal
@@ -54,16 +91,37 @@ int compare_process_name(const void *a, const void *b);
  */
 int main(int argc, char *argv[])
 {
-  char linea[80];
+  char *linea = NULL;
+  size_t size = 0;
   FILE *fd;
   split_list *t;
   char **args;
   int arrival_time;
   int execution_time;
+  int *bursts;
+  int nbursts;
+  int io = 0;
+  int dependencies = 0;
+  char *after;
   int priority;
   int quantum;
   int simulated = 0;
   int current_pid;
+  int nthreads;
+  int gang;
+  int group;
+  char thread_name[80];
+  int nclients;
+  int njobs;
+  int think;
+  process *job;
+  sim_mode mode = EXACT;
+  fluid_result *estimate;
+  int sweep_queue = 0;
+  int nsweep = 0;
+  int sweep_quanta[MAX_PARTS];
+  sweep_result *sweep;
+  sched_config config;
 
   int i;
   int nqueues;
@@ -71,12 +129,18 @@ int main(int argc, char *argv[])
   /* Referencia al arreglo de colas de prioridad */
   priority_queue *queues;
 
-  /* Lista de procesos */
-  list *processes;
+  /* Tabla de procesos */
+  process_table *table;
 
   /* Referencia a un proceso */
   process *p;
 
+  /* Referencia a un hilo de un grupo */
+  process *thread;
+
+  /* Lista de slices de un hilo */
+  list *slices;
+
   /* Nombre de archivo con los parametros de simulacion, si es proporcionado por linea de comandos */
   char *filename;
 
@@ -89,6 +153,14 @@ int main(int argc, char *argv[])
   // Asignar un nombre por defecto al archivo
   filename = "gantt";
 
+  // --stats imprime los contadores y tiempos al terminar el programa
+  if (argc >= 2 && equals(argv[1], "--stats"))
+  {
+    atexit(print_stats);
+    argc--;
+    argv++;
+  }
+
   if (argc < 2)
   {
     /* Si el programa se invoca sin argumentos, tomar la entrada de Stdin. */
@@ -110,15 +182,16 @@ int main(int argc, char *argv[])
   plot_filename = concat(remove_extension(filename), ".gpi");
 
   nqueues = 0;
+  init_config(&config);
+  config.series = concat(remove_extension(filename), ".csv");
+  config.trace_file = concat(remove_extension(filename), ".json");
+  STATS_BEGIN(STATS_PARSE);
 
   /* Lectura del archivo de configuracion */
-  while (!feof(fd))
+  // Leer cada linea del flujo de datos de entrada, getline agranda el buffer para lineas de cualquier longitud
+  while (getline(&linea, &size, fd) != -1)
   {
 
-    // Leer una linea del flujo de datos de entrada
-    memset(linea, 0, 80);
-    fgets(linea, 80, fd);
-
     // printf("Linea leida: %s", linea);
 
     if (strlen(linea) <= 1)
@@ -156,7 +229,7 @@ int main(int argc, char *argv[])
         if (nqueues > 0)
         {
           queues = create_queues(nqueues);
-          processes = create_list();
+          table = create_process_table();
         }
         simulated = 0;
         current_pid = 0;
@@ -190,6 +263,26 @@ int main(int argc, char *argv[])
         {
           queues[i].strategy = SRT;
         }
+        else if (equals(args[3], "cfs"))
+        {
+          queues[i].strategy = CFS;
+        }
+        else if (equals(args[3], "edf"))
+        {
+          queues[i].strategy = EDF;
+        }
+        else if (equals(args[3], "lottery"))
+        {
+          queues[i].strategy = LOTTERY;
+        }
+        else if (equals(args[3], "stride"))
+        {
+          queues[i].strategy = STRIDE;
+        }
+        else if (equals(args[3], "cp"))
+        {
+          queues[i].strategy = CP;
+        }
       }
       else if (equals(args[1], "quantum") && t->count >= 4)
       {
@@ -205,10 +298,236 @@ int main(int argc, char *argv[])
         }
         queues[i].quantum = quantum;
       }
+      else if ((equals(args[1], "latency") || equals(args[1], "granularity")) && t->count >= 4)
+      {
+        // Comando latency n TIEMPO | granularity n TIEMPO (colas CFS)
+        i = atoi(args[2]) - 1;
+        if (i < 0 || i >= nqueues || atoi(args[3]) <= 0)
+        {
+          free_split_list(t);
+          continue;
+        }
+        if (equals(args[1], "latency"))
+        {
+          queues[i].latency = atoi(args[3]);
+        }
+        else
+        {
+          queues[i].granularity = atoi(args[3]);
+        }
+      }
+      else if (equals(args[1], "mode"))
+      {
+        // Comando mode EXACT | FLUID | COMPARE
+        if (equals(args[2], "exact"))
+        {
+          mode = EXACT;
+        }
+        else if (equals(args[2], "fluid"))
+        {
+          mode = FLUID;
+        }
+        else if (equals(args[2], "compare"))
+        {
+          mode = COMPARE;
+        }
+        else
+        {
+          fprintf(stderr, "Unknown simulation mode %s\n", args[2]);
+        }
+      }
+      else if (equals(args[1], "preemption"))
+      {
+        // Comando preemption NONE | ALL | [PRIORITY] [SRT] [EDF]
+        config.preemption = PREEMPT_NONE;
+        for (i = 2; i < t->count; i++)
+        {
+          if (equals(args[i], "none"))
+          {
+            config.preemption = PREEMPT_NONE;
+          }
+          else if (equals(args[i], "priority"))
+          {
+            config.preemption |= PREEMPT_PRIORITY;
+          }
+          else if (equals(args[i], "srt"))
+          {
+            config.preemption |= PREEMPT_SRT;
+          }
+          else if (equals(args[i], "edf"))
+          {
+            config.preemption |= PREEMPT_EDF;
+          }
+          else if (equals(args[i], "all"))
+          {
+            config.preemption = PREEMPT_ALL;
+          }
+          else
+          {
+            fprintf(stderr, "Unknown preemption rule %s\n", args[i]);
+          }
+        }
+      }
+      else if (equals(args[1], "mlfq"))
+      {
+        // Comando mlfq ON | OFF
+        config.mlfq = equals(args[2], "on");
+      }
+      else if (equals(args[1], "aging"))
+      {
+        // Comando aging TIEMPO, 0 = sin envejecimiento
+        config.aging = atoi(args[2]);
+      }
+      else if (equals(args[1], "boost"))
+      {
+        // Comando boost PERIODO, 0 = sin impulso
+        config.boost = atoi(args[2]);
+      }
+      else if (equals(args[1], "devices"))
+      {
+        // Comando devices N, dispositivos de E/S
+        i = atoi(args[2]);
+        if (i < 1 || i > MAX_DEVICES)
+        {
+          fprintf(stderr, "Devices must be between 1 and %d\n", MAX_DEVICES);
+        }
+        else
+        {
+          config.devices = i;
+        }
+      }
+      else if (equals(args[1], "switch"))
+      {
+        // Comando switch TIEMPO, duracion de un cambio de contexto
+        config.switch_cost = max(0, atoi(args[2]));
+      }
+      else if (equals(args[1], "reload"))
+      {
+        // Comando reload MAXIMO [ENFRIAMIENTO], penalizacion por recargar la cache
+        config.reload_cost = max(0, atoi(args[2]));
+        if (t->count >= 4 && atoi(args[3]) > 0)
+        {
+          config.reload_decay = atoi(args[3]);
+        }
+      }
+      else if (equals(args[1], "topology") && t->count >= 4)
+      {
+        // Comando topology SOCKETS CORES, procesadores por socket
+        if (atoi(args[2]) < 1 || atoi(args[2]) > MAX_SOCKETS || atoi(args[3]) < 1)
+        {
+          fprintf(stderr, "Topology must have 1 to %d sockets with at least one core\n", MAX_SOCKETS);
+        }
+        else
+        {
+          config.sockets = atoi(args[2]);
+          config.cores = atoi(args[3]);
+        }
+      }
+      else if (equals(args[1], "placement"))
+      {
+        // Comando placement LOCAL | SPREAD | PACK
+        if (equals(args[2], "local"))
+        {
+          config.placement = PLACE_LOCAL;
+        }
+        else if (equals(args[2], "spread"))
+        {
+          config.placement = PLACE_SPREAD;
+        }
+        else if (equals(args[2], "pack"))
+        {
+          config.placement = PLACE_PACK;
+        }
+        else
+        {
+          fprintf(stderr, "Unknown placement policy %s\n", args[2]);
+        }
+      }
+      else if (equals(args[1], "migration"))
+      {
+        // Comando migration TIEMPO, penalizacion por cambiar de socket
+        config.migration_cost = max(0, atoi(args[2]));
+      }
+      else if (equals(args[1], "cgroup") && t->count >= 4)
+      {
+        // Comando cgroup RUTA PESO [CUOTA PERIODO], el padre de web/api es web
+        // Los grupos se guardan en la tabla de procesos, que crea DEFINE queues
+        if (nqueues <= 0)
+        {
+          fprintf(stderr, "Group %s must be defined after DEFINE queues\n", args[2]);
+          free_split_list(t);
+          continue;
+        }
+        if (t->count >= 6)
+        {
+          create_cgroup(table, args[2], atoi(args[3]), atoi(args[4]), atoi(args[5]));
+        }
+        else
+        {
+          create_cgroup(table, args[2], atoi(args[3]), 0, 0);
+        }
+      }
+      else if (equals(args[1], "gang"))
+      {
+        // Comando gang ON | OFF, ejecucion simultanea de los hilos de los grupos gang=N
+        config.gang = equals(args[2], "on");
+      }
+      else if (equals(args[1], "quiet"))
+      {
+        // Comando quiet ON | OFF, imprimir solo el resumen, sin eventos, listados por proceso ni grafica
+        config.quiet = equals(args[2], "on");
+      }
+      else if (equals(args[1], "trace"))
+      {
+        // Comando trace ON [BLOCK | DROP] | OFF, exportar la simulacion a ARCHIVO.json (Trace Event JSON)
+        // BLOCK: la simulacion espera al escritor si su anillo se llena; DROP: descarta y cuenta los eventos
+        config.trace_events = equals(args[2], "on");
+        config.trace_drop = (t->count >= 4 && equals(args[3], "drop"));
+      }
+      else if (equals(args[1], "window"))
+      {
+        // Comando window N, serie de tiempo por ventanas de N unidades en ARCHIVO.csv, 0 = sin serie
+        i = atoi(args[2]);
+        if (i < 0)
+        {
+          fprintf(stderr, "Window must be zero or positive\n");
+        }
+        else
+        {
+          config.window = i;
+        }
+      }
+      else if (equals(args[1], "seed"))
+      {
+        // Comando seed N, semilla de los sorteos de LOTTERY y de los tiempos de reflexion de los clientes
+        config.seed = strtoull(args[2], 0, 10);
+      }
+      else if (equals(args[1], "sweep") && t->count >= 4)
+      {
+        // Comando sweep n QUANTUM1 QUANTUM2 ...
+        // n = 1 ... # de colas de prioridad
+        i = atoi(args[2]) - 1;
+        if (i < 0 || i >= nqueues)
+        {
+          free_split_list(t);
+          continue;
+        }
+        if (queues[i].strategy != RR)
+        {
+          fprintf(stderr, "Queue %d is not RR, the quantum has no effect\n", i + 1);
+        }
+        sweep_queue = i;
+        for (nsweep = 0; nsweep + 3 < t->count; nsweep++)
+        {
+          sweep_quanta[nsweep] = atoi(args[nsweep + 3]);
+        }
+        mode = SWEEP;
+      }
     }
     else if (equals(args[0], "process") && t->count >= 4)
     {
-      // Comando process NAME ARRIVAL_TIME EXEC_TIME PRIORITY
+      // Comando process NAME ARRIVAL_TIME EXEC_TIME PRIORITY [nice=N] [deadline=D] [tickets=T] [device=D] [node=S] [threads=N | gang=N] [cgroup=RUTA] [after=A,B]
+      // EXEC_TIME puede ser una lista de rafagas alternas de CPU y E/S: CPU,E/S,...,CPU
       // printf("process %s\n", args[1]);
 
       // Verificar el tiempo de llegada
@@ -222,14 +541,25 @@ int main(int argc, char *argv[])
       }
 
       // Verificar el tiempo de ejecucion
-      execution_time = -1;
-      execution_time = atoi(args[3]);
-      if (execution_time <= 0)
+      nbursts = parse_bursts(args[3], &bursts);
+      if (nbursts == 0)
       {
         fprintf(stderr, "Execution time must be greater than zero\n");
         free_split_list(t);
         continue;
       }
+      if (nbursts % 2 == 0)
+      {
+        fprintf(stderr, "Bursts must alternate CPU and I/O, starting and ending with CPU\n");
+        free(bursts);
+        free_split_list(t);
+        continue;
+      }
+      execution_time = 0;
+      for (i = 0; i < nbursts; i += 2)
+      {
+        execution_time += (bursts != NULL) ? bursts[i] : atoi(args[3]);
+      }
 
       // Verificar la cola de prioridad
       priority = 1; //Suponer prioridad  = 1
@@ -239,42 +569,283 @@ int main(int argc, char *argv[])
       if (priority <= 0 || priority > nqueues)
       {
         fprintf(stderr, "Priority %d does not exist\n", priority);
+        free(bursts);
         free_split_list(t);
         continue;
       }
 
-      p = create_process(args[1], arrival_time, execution_time);
+      p = create_process(table, args[1], arrival_time, execution_time);
 
       p->priority = priority - 1;
-      p->pid = ++current_pid;
+      p->base_priority = p->priority;
+      p->bursts = bursts;
+      p->nbursts = nbursts;
+      if (nbursts > 1)
+      {
+        io = 1;
+      }
 
-      // Insertar el proceso en la lista general de procesos
-      insert_ordered(processes, p, compare_process_name);
+      // Atributos opcionales clave=valor
+      nthreads = 1;
+      gang = 0;
+      after = NULL;
+      for (i = 5; i < t->count; i++)
+      {
+        if (strncmp(args[i], "nice=", 5) == 0)
+        {
+          p->weight = nice_weight(atoi(args[i] + 5));
+        }
+        else if (strncmp(args[i], "deadline=", 9) == 0)
+        {
+          p->deadline = atoi(args[i] + 9);
+        }
+        else if (strncmp(args[i], "tickets=", 8) == 0)
+        {
+          // Un proceso sin boletos nunca ganaria un sorteo
+          p->tickets = max(1, atoi(args[i] + 8));
+        }
+        else if (strncmp(args[i], "node=", 5) == 0)
+        {
+          if (atoi(args[i] + 5) < 1 || atoi(args[i] + 5) > config.sockets)
+          {
+            fprintf(stderr, "Socket %d does not exist\n", atoi(args[i] + 5));
+          }
+          else
+          {
+            p->node = atoi(args[i] + 5) - 1;
+          }
+        }
+        else if (strncmp(args[i], "device=", 7) == 0)
+        {
+          if (atoi(args[i] + 7) < 1 || atoi(args[i] + 7) > config.devices)
+          {
+            fprintf(stderr, "Device %d does not exist\n", atoi(args[i] + 7));
+          }
+          else
+          {
+            p->device = atoi(args[i] + 7) - 1;
+          }
+        }
+        else if (strncmp(args[i], "cgroup=", 7) == 0)
+        {
+          if (find_cgroup(table, args[i] + 7) < 0)
+          {
+            fprintf(stderr, "Group %s does not exist\n", args[i] + 7);
+          }
+          else
+          {
+            p->cgroup = find_cgroup(table, args[i] + 7);
+          }
+        }
+        else if (strncmp(args[i], "after=", 6) == 0)
+        {
+          after = args[i] + 6;
+        }
+        else if (strncmp(args[i], "threads=", 8) == 0 || strncmp(args[i], "gang=", 5) == 0)
+        {
+          gang = (args[i][0] == 'g');
+          nthreads = atoi(strchr(args[i], '=') + 1);
+          if (nthreads < 1)
+          {
+            fprintf(stderr, "A process group must have at least one thread\n");
+            nthreads = 1;
+          }
+        }
+        else
+        {
+          fprintf(stderr, "Unknown process attribute %s\n", args[i]);
+        }
+      }
+
+      if (nthreads == 1 && !gang)
+      {
+        p->pid = ++current_pid;
+
+        // Insertar el proceso en la lista general de procesos, que se ordena por nombre al iniciar
+        push_back(table->processes, p);
+        if (after != NULL)
+        {
+          dependencies += parse_dependencies(table, after, table->count - 1);
+        }
+        free_split_list(t);
+        continue;
+      }
+
+      // Cada hilo del grupo es una copia del proceso: NAME.1 ... NAME.N
+      group = create_group(table, args[1], nthreads, gang);
+      for (i = 0; i < nthreads; i++)
+      {
+        snprintf(thread_name, sizeof(thread_name), "%s.%d", args[1], i + 1);
+        thread = p;
+        if (i > 0)
+        {
+          thread = create_process(table, thread_name, arrival_time, execution_time);
+          slices = thread->slices;
+          *thread = *p;
+          thread->slices = slices;
+        }
+        thread->name = intern(table->names, thread_name);
+        thread->group = group;
+        thread->pid = ++current_pid;
+        table->groups[group].threads[i] = thread;
+        push_back(table->processes, thread);
+      }
+      // Todos los hilos dependen de los mismos predecesores
+      if (after != NULL)
+      {
+        dependencies += parse_dependencies(table, after, table->count - nthreads);
+      }
+    }
+    else if (equals(args[0], "client") && t->count >= 6)
+    {
+      // Comando client NAME COUNT JOBS BURST THINK [PRIORITY]
+      // Cada cliente emite JOBS trabajos NAME.C.K, uno a la vez, con un tiempo medio de reflexion THINK entre ellos
+      nclients = atoi(args[2]);
+      njobs = atoi(args[3]);
+      think = atoi(args[5]);
+      if (nclients < 1 || njobs < 1)
+      {
+        fprintf(stderr, "A client line must have at least one client and one job\n");
+        free_split_list(t);
+        continue;
+      }
+      if (think < 0)
+      {
+        fprintf(stderr, "Think time must not be negative\n");
+        free_split_list(t);
+        continue;
+      }
+
+      // Verificar el tiempo de ejecucion
+      nbursts = parse_bursts(args[4], &bursts);
+      if (nbursts == 0 || nbursts % 2 == 0)
+      {
+        fprintf(stderr, "Bursts must alternate CPU and I/O, starting and ending with CPU\n");
+        free(bursts);
+        free_split_list(t);
+        continue;
+      }
+      execution_time = 0;
+      for (i = 0; i < nbursts; i += 2)
+      {
+        execution_time += (bursts != NULL) ? bursts[i] : atoi(args[4]);
+      }
+      if (nbursts > 1)
+      {
+        io = 1;
+      }
+
+      // Verificar la cola de prioridad
+      priority = (t->count >= 7) ? atoi(args[6]) : 1;
+      if (priority <= 0 || priority > nqueues)
+      {
+        fprintf(stderr, "Priority %d does not exist\n", priority);
+        free(bursts);
+        free_split_list(t);
+        continue;
+      }
+
+      // Los trabajos de cada cliente forman una cadena: cada uno llega cuando termina el anterior
+      create_client_pool(table, args[1], nclients, njobs, think);
+      for (i = 0; i < nclients * njobs; i++)
+      {
+        snprintf(thread_name, sizeof(thread_name), "%s.%d.%d", args[1], i / njobs + 1, i % njobs + 1);
+        job = create_process(table, thread_name, 0, execution_time);
+        job->priority = priority - 1;
+        job->base_priority = job->priority;
+        job->bursts = bursts;
+        job->nbursts = nbursts;
+        job->pid = ++current_pid;
+        if (i % njobs > 0)
+        {
+          add_dependency(table_process(table, table->count - 2), job);
+          dependencies++;
+        }
+        push_back(table->processes, job);
+      }
     }
     else if (equals(args[0], "start"))
     {
       // Comando start
+      // Ordenar una sola vez los procesos por nombre, en lugar de insertar cada uno en orden
+      sort_list(table->processes, compare_process_name);
+      STATS_END(STATS_PARSE);
+      if (mode == SWEEP)
+      {
+        // Barrido de quantum, no genera la grafica
+        warn_unsupported(queues, nqueues, &config, io, table->ncgroups, dependencies);
+        if (config.preemption != PREEMPT_NONE)
+        {
+          fprintf(stderr, "Preemption rules are not applied in quantum sweeps\n");
+        }
+        STATS_BEGIN(STATS_SIMULATE);
+        sweep = schedule_sweep(table->processes, queues, nqueues, &config, sweep_queue, sweep_quanta, nsweep);
+        STATS_END(STATS_SIMULATE);
+        print_sweep_results(sweep, nsweep, sweep_queue, table->count);
+        free(sweep);
+        simulated = 1;
+        STATS_BEGIN(STATS_PARSE);
+        free_split_list(t);
+        continue;
+      }
+
+      if (mode == FLUID || mode == COMPARE)
+      {
+        warn_unsupported(queues, nqueues, &config, io, table->ncgroups, dependencies);
+        if (config.switch_cost > 0 || config.reload_cost > 0)
+        {
+          fprintf(stderr, "The approximation ignores context-switch and cache reload costs\n");
+        }
+        // Aproximacion fluida, no genera la grafica
+        STATS_BEGIN(STATS_SIMULATE);
+        estimate = schedule_fluid(table->processes, queues, nqueues);
+        STATS_END(STATS_SIMULATE);
+        print_fluid_result(estimate);
+        if (mode == FLUID)
+        {
+          destroy_fluid_result(estimate);
+          simulated = 1;
+          STATS_BEGIN(STATS_PARSE);
+          free_split_list(t);
+          continue;
+        }
+      }
+
       // Comenzar la simulacion!!!
-      schedule(processes, queues, nqueues);
+      schedule(table, queues, nqueues, &config);
+
+      if (mode == COMPARE)
+      {
+        compare_fluid_result(estimate);
+        destroy_fluid_result(estimate);
+      }
 
       // Crear la grafica de la simulacion
-      create_plot(plot_filename, processes);
+      if (!config.quiet)
+      {
+        STATS_BEGIN(STATS_PLOT);
+        create_plot(plot_filename, table);
+        STATS_END(STATS_PLOT);
 
-      printf("Gannt plot saved to %s\n", plot_filename);
+        printf("Gannt plot saved to %s\n", plot_filename);
+      }
 
       simulated = 1;
+      STATS_BEGIN(STATS_PARSE);
     }
     else if (equals(args[0], "exit"))
     {
       printf("Finished\n");
       free_split_list(t);
+      free(linea);
       exit(EXIT_SUCCESS);
     }
     free_split_list(t);
   }
+  free(linea);
 }
 
-int compare_process_name(const void *a, const void *b)
+int compare_process_name(void *const a, void *const b)
 {
   process *p1;
   process *p2;
@@ -284,3 +855,121 @@ int compare_process_name(const void *a, const void *b)
 
   return strcmp(p2->name, p1->name);
 }
+
+void warn_unsupported(priority_queue *queues, int nqueues, const sched_config *config, int io, int cgroups,
+                      int dependencies)
+{
+  int i;
+
+  for (i = 0; i < nqueues; i++)
+  {
+    if (queues[i].strategy == CFS || queues[i].strategy == EDF ||
+        queues[i].strategy == LOTTERY || queues[i].strategy == STRIDE || queues[i].strategy == CP)
+    {
+      fprintf(stderr, "Queue %d is %s, the approximation serves it as FIFO\n", i + 1, get_strategy_ops(queues[i].strategy)->name);
+    }
+  }
+  if (io)
+  {
+    fprintf(stderr, "The approximation ignores I/O bursts, processes run their CPU bursts back to back\n");
+  }
+  if (config->sockets * config->cores > 1)
+  {
+    fprintf(stderr, "The approximation models a single CPU, the topology is ignored\n");
+  }
+  if (cgroups > 0)
+  {
+    fprintf(stderr, "The approximation ignores control groups, their weights and quotas\n");
+  }
+  if (dependencies > 0)
+  {
+    fprintf(stderr, "The approximation ignores dependencies, processes arrive at their arrival time\n");
+  }
+}
+
+int parse_dependencies(process_table *table, const char *spec, int first)
+{
+  char name[80];
+  const char *end;
+  process *pred;
+  int found;
+  int added;
+  int len;
+  int i;
+  int j;
+
+  added = 0;
+  while (*spec != 0)
+  {
+    end = strchr(spec, ',');
+    if (end == NULL)
+    {
+      end = spec + strlen(spec);
+    }
+    len = min((int)(end - spec), (int)sizeof(name) - 1);
+    strncpy(name, spec, len);
+    name[len] = 0;
+    spec = (*end == ',') ? end + 1 : end;
+
+    // Solo los procesos anteriores pueden ser predecesores, asi el grafo no tiene ciclos
+    found = 0;
+    for (i = 0; i < first; i++)
+    {
+      pred = table_process(table, i);
+      if (strcmp(pred->name, name) == 0 ||
+          (pred->group >= 0 && strcmp(table->groups[pred->group].name, name) == 0))
+      {
+        for (j = first; j < table->count; j++)
+        {
+          add_dependency(pred, table_process(table, j));
+          added++;
+        }
+        found = 1;
+      }
+    }
+    if (!found)
+    {
+      fprintf(stderr, "Process %s must be defined before the processes that depend on it\n", name);
+    }
+  }
+  return added;
+}
+
+int parse_bursts(const char *spec, int **bursts)
+{
+  const char *ptr;
+  char *end;
+  int n;
+  int i;
+
+  // Contar las rafagas
+  n = 1;
+  for (ptr = spec; *ptr != 0; ptr++)
+  {
+    if (*ptr == ',')
+    {
+      n++;
+    }
+  }
+
+  *bursts = NULL;
+  if (n == 1)
+  {
+    return (atoi(spec) > 0) ? 1 : 0;
+  }
+
+  *bursts = (int *)malloc(sizeof(int) * n);
+  ptr = spec;
+  for (i = 0; i < n; i++)
+  {
+    (*bursts)[i] = (int)strtol(ptr, &end, 10);
+    if ((*bursts)[i] <= 0)
+    {
+      free(*bursts);
+      *bursts = NULL;
+      return 0;
+    }
+    ptr = end + 1;
+  }
+  return n;
+}
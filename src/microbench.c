@@ -0,0 +1,320 @@
+/**
+ * @file
+ * @brief Microbenchmark de las listas y de las colas de listos.
+ * @copyright MIT License
+ *
+ * Mide en aislamiento las operaciones de las colas de listos:
+ *  - fifo: n veces push_back y luego n veces pop_front.
+ *  - hold: con la cola llena con n procesos, cada operacion retira el primero
+ *    y lo vuelve a insertar con una clave mayor (modelo "hold" clasico de
+ *    las colas de prioridad). La cola conserva n procesos.
+ * La operacion hold se repite con cada funcion de comparacion y con cada
+ * implementacion de cola ordenada de la tabla queue_impls. Una nueva
+ * implementacion se compara con las demas agregando una entrada a la tabla.
+ *
+ * Imprime una linea CSV por medicion, con el tiempo y las comparaciones por
+ * operacion.
+ *
+ * Ejecucion:
+ *  make microbench
+ *  ./microbench [ops]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "heap.h"
+#include "list.h"
+#include "rbtree.h"
+#include "sched.h"
+#include "util.h"
+
+/** @brief Operaciones por medicion, por defecto */
+#define DEFAULT_OPS 20000
+
+/** @brief Implementacion de una cola ordenada de procesos */
+typedef struct
+{
+  const char *name;                                                  /*!< Nombre de la implementacion */
+  void *(*create)(int (*compare)(void *const, void *const));         /*!< Crea una cola vacia */
+  void (*insert)(void *q, process *p);                               /*!< Inserta un proceso */
+  process *(*pop)(void *q);                                          /*!< Retira el primer proceso */
+  void (*destroy)(void *q);                                          /*!< Destruye la cola, sin los procesos */
+} queue_impl;
+
+/** @brief Funcion de comparacion a medir */
+typedef struct
+{
+  const char *name;                          /*!< Nombre de la funcion */
+  int (*compare)(void *const, void *const);  /*!< Funcion de comparacion */
+} comparator;
+
+/** @brief Funcion de comparacion de la medicion actual */
+static int (*measured)(void *const, void *const);
+
+/** @brief Comparaciones de la medicion actual */
+static unsigned long long comparisons;
+
+/**
+ * @brief Cuenta una comparacion y llama a la funcion medida
+ * @param a Proceso A
+ * @param b Proceso B
+ * @return Resultado de la funcion medida
+ */
+static int counted_compare(void *const a, void *const b)
+{
+  comparisons++;
+  return measured(a, b);
+}
+
+/** @brief Lista ordenada con insert_ordered */
+static void *list_create(int (*compare)(void *const, void *const))
+{
+  return create_list();
+}
+
+/** @brief Inserta en orden en la lista */
+static void list_insert(void *q, process *p)
+{
+  insert_ordered((list *)q, p, counted_compare);
+}
+
+/** @brief Retira el primero de la lista */
+static process *list_pop(void *q)
+{
+  process *p;
+
+  p = (process *)front((list *)q);
+  pop_front((list *)q);
+  return p;
+}
+
+/** @brief Destruye la lista */
+static void list_destroy(void *q)
+{
+  destroy_list((list *)q, 0);
+}
+
+/** @brief Monticulo binario */
+static void *heap_create(int (*compare)(void *const, void *const))
+{
+  return create_heap(compare);
+}
+
+/** @brief Inserta en el monticulo */
+static void heap_insert(void *q, process *p)
+{
+  heap_push((heap *)q, p);
+}
+
+/** @brief Retira el primero del monticulo */
+static process *heap_pop_first(void *q)
+{
+  return (process *)heap_pop((heap *)q);
+}
+
+/** @brief Destruye el monticulo */
+static void heap_destroy(void *q)
+{
+  destroy_heap((heap *)q, 0);
+}
+
+/** @brief Arbol rojo-negro */
+static void *rbtree_create(int (*compare)(void *const, void *const))
+{
+  return create_rbtree(compare);
+}
+
+/** @brief Inserta en el arbol */
+static void rbtree_insert(void *q, process *p)
+{
+  rb_insert((rbtree *)q, p);
+}
+
+/** @brief Retira el primero del arbol */
+static process *rbtree_pop(void *q)
+{
+  return (process *)rb_pop_first((rbtree *)q);
+}
+
+/** @brief Destruye el arbol */
+static void rbtree_destroy(void *q)
+{
+  destroy_rbtree((rbtree *)q, 0);
+}
+
+/** @brief Implementaciones de colas ordenadas a comparar */
+static const queue_impl queue_impls[] = {
+    {"list", list_create, list_insert, list_pop, list_destroy},
+    {"heap", heap_create, heap_insert, heap_pop_first, heap_destroy},
+    {"rbtree", rbtree_create, rbtree_insert, rbtree_pop, rbtree_destroy},
+};
+
+/** @brief Funciones de comparacion a medir */
+static const comparator comparators[] = {
+    {"compare_sjf", compare_sjf},
+    {"compare_srt", compare_srt},
+    {"compare_arrival", compare_arrival},
+};
+
+/** @brief Tamanos de cola */
+static const int sizes[] = {16, 256, 4096, 16384};
+
+/**
+ * @brief Tiempo actual en nanosegundos
+ * @return Tiempo monotono
+ */
+static double now_ns(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/**
+ * @brief Crea n procesos con claves aleatorias
+ * @param n Cantidad de procesos
+ * @param rng Estado del generador
+ * @return Arreglo de procesos
+ */
+static process *create_processes(int n, unsigned long long *rng)
+{
+  process *processes;
+  int i;
+
+  processes = (process *)calloc(n, sizeof(process));
+  for (i = 0; i < n; i++)
+  {
+    processes[i].arrival_time = (int)(next_random(rng) % 1000);
+    processes[i].remaining_time = 1 + (int)(next_random(rng) % 100);
+    processes[i].execution_time = processes[i].remaining_time;
+  }
+  return processes;
+}
+
+/**
+ * @brief Mide push_back y pop_front de una lista
+ * @param n Cantidad de procesos
+ * @param rounds Repeticiones, para medir al menos ops operaciones
+ * @param processes Procesos
+ */
+static void bench_fifo(int n, int rounds, process *processes)
+{
+  list *l;
+  double start;
+  double push;
+  double pop;
+  int r;
+  int i;
+
+  l = create_list();
+  push = 0;
+  pop = 0;
+  for (r = 0; r < rounds; r++)
+  {
+    start = now_ns();
+    for (i = 0; i < n; i++)
+    {
+      push_back(l, &processes[i]);
+    }
+    push += now_ns() - start;
+    start = now_ns();
+    for (i = 0; i < n; i++)
+    {
+      pop_front(l);
+    }
+    pop += now_ns() - start;
+  }
+  destroy_list(l, 0);
+
+  printf("push_back,list,-,%d,%ld,%.1f,0\n", n, (long)n * rounds, push / ((double)n * rounds));
+  printf("pop_front,list,-,%d,%ld,%.1f,0\n", n, (long)n * rounds, pop / ((double)n * rounds));
+}
+
+/**
+ * @brief Mide la operacion hold de una implementacion con una funcion de comparacion
+ * @param impl Implementacion de la cola
+ * @param cmp Funcion de comparacion
+ * @param n Procesos en la cola
+ * @param ops Operaciones hold
+ * @param processes Procesos
+ * @param rng Estado del generador
+ */
+static void bench_hold(const queue_impl *impl, const comparator *cmp, int n, int ops, process *processes,
+                       unsigned long long *rng)
+{
+  void *q;
+  process *p;
+  double start;
+  double elapsed;
+  int i;
+
+  measured = cmp->compare;
+  q = impl->create(counted_compare);
+  for (i = 0; i < n; i++)
+  {
+    impl->insert(q, &processes[i]);
+  }
+
+  comparisons = 0;
+  start = now_ns();
+  for (i = 0; i < ops; i++)
+  {
+    // La clave avanza un incremento aleatorio, como el tiempo de la simulacion
+    p = impl->pop(q);
+    p->arrival_time += 1 + (int)(next_random(rng) % 200);
+    p->remaining_time += 1 + (int)(next_random(rng) % 20);
+    impl->insert(q, p);
+  }
+  elapsed = now_ns() - start;
+  impl->destroy(q);
+
+  printf("hold,%s,%s,%d,%d,%.1f,%.2f\n", impl->name, cmp->name, n, ops, elapsed / ops, (double)comparisons / ops);
+}
+
+/**
+ * @brief Programa principal del microbenchmark
+ * @param argc Cantidad de argumentos
+ * @param argv Operaciones por medicion (opcional)
+ */
+int main(int argc, char *argv[])
+{
+  unsigned long long rng;
+  process *processes;
+  int ops;
+  int s;
+  int c;
+  int i;
+
+  ops = (argc > 1) ? atoi(argv[1]) : DEFAULT_OPS;
+  if (ops < 1)
+  {
+    fprintf(stderr, "Operations must be greater than zero\n");
+    exit(EXIT_FAILURE);
+  }
+
+  printf("operation,implementation,comparator,size,ops,ns_per_op,compares_per_op\n");
+  for (s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    rng = 1;
+    processes = create_processes(sizes[s], &rng);
+    bench_fifo(sizes[s], (ops + sizes[s] - 1) / sizes[s], processes);
+    for (c = 0; c < (int)(sizeof(comparators) / sizeof(comparators[0])); c++)
+    {
+      for (i = 0; i < (int)(sizeof(queue_impls) / sizeof(queue_impls[0])); i++)
+      {
+        // Cada medicion parte de las mismas claves
+        rng = 1;
+        free(processes);
+        processes = create_processes(sizes[s], &rng);
+        bench_hold(&queue_impls[i], &comparators[c], sizes[s], ops, processes, &rng);
+      }
+    }
+    free(processes);
+  }
+
+  return 0;
+}
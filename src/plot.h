@@ -1,19 +1,19 @@
-/**
- * @file
- * @brief Definiciones del modulo para generar el diagrama de Gantt de la planificacion.
- * @author Erwin Meza Vega <emezav@unicauca.edu.co>
- * @copyright MIT License
- */
-
-#include <stdio.h>
-#include <stdlib.h>
-
-#include "list.h"
-
-/**
- * @brief Crea el diagrama de Gantt con los procesos simulados.
- * @param path Ruta del archivo de salida
- * @param processes Lista de procesos simulados.
- * @return 1 si se puede crear la grafica, 0 en caso contrario.
- */
-int create_plot(char *path, list *processes);
+/**
+ * @file
+ * @brief Definiciones del modulo para generar el diagrama de Gantt de la planificacion.
+ * @author Erwin Meza Vega <emezav@unicauca.edu.co>
+ * @copyright MIT License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sched.h"
+
+/**
+ * @brief Crea el diagrama de Gantt con los procesos simulados.
+ * @param path Ruta del archivo de salida
+ * @param table Tabla de procesos simulados.
+ * @return 1 si se puede crear la grafica, 0 en caso contrario.
+ */
+int create_plot(char *path, process_table *table);
@@ -0,0 +1,368 @@
+/**
+ * @file
+ * @brief Estrategias de planificacion como tablas de operaciones.
+ * @copyright MIT License
+ */
+
+#include "policy.h"
+#include "util.h"
+
+const strategy_ops fifo_ops = {"FIFO", fifo_enqueue, ready_pick, unbounded_slice, never_expire, fifo_enqueue, list_count, list_remove};
+
+const strategy_ops sjf_ops = {"SJF", sjf_enqueue, ready_pick, unbounded_slice, never_expire, sjf_enqueue, list_count, list_remove};
+
+const strategy_ops rr_ops = {"RR", fifo_enqueue, ready_pick, quantum_slice, quantum_expire, fifo_enqueue, list_count, list_remove};
+
+const strategy_ops srt_ops = {"SRT", srt_enqueue, ready_pick, unbounded_slice, never_expire, srt_enqueue, list_count, list_remove};
+
+/** @brief Pesos de CFS para nice -20 ... 19, cada nivel cambia la proporcion de CPU en ~10% */
+static const int nice_to_weight[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+    9548, 7620, 6100, 4904, 3906,
+    3121, 2501, 1991, 1586, 1277,
+    1024, 820, 655, 526, 423,
+    335, 272, 215, 172, 137,
+    110, 87, 70, 56, 45,
+    36, 29, 23, 18, 15};
+
+/**
+ * @brief Inserta un proceso en el arbol de la cola CFS
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void cfs_insert(priority_queue *q, process *p)
+{
+  rb_insert(q->tree, p);
+  q->load += p->weight;
+}
+
+/**
+ * @brief Inserta un proceso que llega: no puede reclamar el tiempo que no estuvo en la cola
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void cfs_enqueue(priority_queue *q, process *p)
+{
+  if (p->vruntime < q->min_vruntime)
+  {
+    p->vruntime = q->min_vruntime;
+  }
+  cfs_insert(q, p);
+}
+
+/**
+ * @brief Retira el proceso con menor vruntime
+ * @param q Cola de prioridad
+ * @return Proceso con menor vruntime
+ */
+static process *cfs_pick(priority_queue *q)
+{
+  process *p;
+
+  p = (process *)rb_pop_first(q->tree);
+  q->load -= p->weight;
+  if (p->vruntime > q->min_vruntime)
+  {
+    q->min_vruntime = p->vruntime;
+  }
+  return p;
+}
+
+/**
+ * @brief Calcula la porcion de la latencia objetivo que corresponde al proceso
+ * @param q Cola de prioridad
+ * @param p Proceso en ejecucion (ya retirado del arbol)
+ * @return Tiempo de ejecucion, al menos la granularidad minima
+ */
+static int cfs_slice(priority_queue *q, process *p)
+{
+  long period;
+  long slice;
+  int running;
+
+  // El periodo se alarga cuando hay mas procesos que latency / granularity
+  running = q->tree->count + 1;
+  period = q->latency;
+  if ((long)running * q->granularity > period)
+  {
+    period = (long)running * q->granularity;
+  }
+  slice = period * p->weight / (q->load + p->weight);
+  if (slice < q->granularity)
+  {
+    slice = q->granularity;
+  }
+  return (slice > 0) ? (int)slice : 1;
+}
+
+/**
+ * @brief Expropia al terminar la porcion si otro proceso tiene menor vruntime
+ * @param q Cola de prioridad
+ * @param p Proceso en ejecucion
+ * @param used Tiempo ejecutado
+ * @return 1 si el proceso debe ser expropiado
+ */
+static int cfs_expire(priority_queue *q, process *p, int used)
+{
+  return !rb_empty(q->tree) && ((process *)rb_first(q->tree))->vruntime < p->vruntime;
+}
+
+/**
+ * @brief Cantidad de procesos listos
+ * @param q Cola de prioridad
+ * @return Procesos en el arbol
+ */
+static int cfs_count(priority_queue *q)
+{
+  return q->tree->count;
+}
+
+/**
+ * @brief Retira un proceso listo del arbol
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void cfs_remove(priority_queue *q, process *p)
+{
+  if (rb_remove(q->tree, p))
+  {
+    q->load -= p->weight;
+  }
+}
+
+const strategy_ops cfs_ops = {"CFS", cfs_enqueue, cfs_pick, cfs_slice, cfs_expire, cfs_insert, cfs_count, cfs_remove};
+
+/**
+ * @brief Inserta un proceso en el monticulo de deadlines
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void edf_enqueue(priority_queue *q, process *p)
+{
+  heap_push(q->deadlines, p);
+}
+
+/**
+ * @brief Retira el proceso con el deadline mas cercano
+ * @param q Cola de prioridad
+ * @return Proceso con el deadline mas cercano
+ */
+static process *edf_pick(priority_queue *q)
+{
+  return (process *)heap_pop(q->deadlines);
+}
+
+/**
+ * @brief Cantidad de procesos listos
+ * @param q Cola de prioridad
+ * @return Procesos en el monticulo
+ */
+static int edf_count(priority_queue *q)
+{
+  return q->deadlines->count;
+}
+
+/**
+ * @brief Retira un proceso listo del monticulo
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void edf_remove(priority_queue *q, process *p)
+{
+  heap_remove(q->deadlines, p);
+}
+
+const strategy_ops edf_ops = {"EDF", edf_enqueue, edf_pick, unbounded_slice, never_expire, edf_enqueue, edf_count, edf_remove};
+
+/**
+ * @brief Agrega los boletos de un proceso al sorteo
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void lottery_enqueue(priority_queue *q, process *p)
+{
+  fenwick_set(q->lottery, p->pid - 1, p->tickets, p);
+}
+
+/**
+ * @brief Sortea el siguiente proceso: cada proceso gana con probabilidad proporcional a sus boletos
+ * @param q Cola de prioridad
+ * @return Proceso ganador, retirado del sorteo
+ */
+static process *lottery_pick(priority_queue *q)
+{
+  process *p;
+  int winner;
+
+  winner = fenwick_find(q->lottery, (long)(next_random(&q->rng) % (unsigned long long)q->lottery->total));
+  p = (process *)q->lottery->data[winner];
+  fenwick_set(q->lottery, winner, 0, 0);
+  return p;
+}
+
+/**
+ * @brief Cantidad de procesos listos
+ * @param q Cola de prioridad
+ * @return Procesos con boletos en el sorteo
+ */
+static int lottery_count(priority_queue *q)
+{
+  return q->lottery->count;
+}
+
+/**
+ * @brief Retira los boletos de un proceso listo
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void lottery_remove(priority_queue *q, process *p)
+{
+  fenwick_set(q->lottery, p->pid - 1, 0, 0);
+}
+
+const strategy_ops lottery_ops = {"LOTTERY", lottery_enqueue, lottery_pick, quantum_slice, quantum_expire, lottery_enqueue, lottery_count, lottery_remove};
+
+/**
+ * @brief Inserta un proceso que llega: su valor de paso parte del menor de la cola
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void stride_enqueue(priority_queue *q, process *p)
+{
+  if (p->pass < q->min_pass)
+  {
+    p->pass = q->min_pass;
+  }
+  heap_push(q->passes, p);
+}
+
+/**
+ * @brief Devuelve un proceso expropiado conservando su valor de paso
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void stride_insert(priority_queue *q, process *p)
+{
+  heap_push(q->passes, p);
+}
+
+/**
+ * @brief Retira el proceso con menor valor de paso
+ * @param q Cola de prioridad
+ * @return Proceso con menor valor de paso
+ */
+static process *stride_pick(priority_queue *q)
+{
+  process *p;
+
+  p = (process *)heap_pop(q->passes);
+  if (p->pass > q->min_pass)
+  {
+    q->min_pass = p->pass;
+  }
+  return p;
+}
+
+/**
+ * @brief Cantidad de procesos listos
+ * @param q Cola de prioridad
+ * @return Procesos en el monticulo
+ */
+static int stride_count(priority_queue *q)
+{
+  return q->passes->count;
+}
+
+/**
+ * @brief Retira un proceso listo del monticulo
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void stride_remove(priority_queue *q, process *p)
+{
+  heap_remove(q->passes, p);
+}
+
+const strategy_ops stride_ops = {"STRIDE", stride_enqueue, stride_pick, quantum_slice, quantum_expire, stride_insert, stride_count, stride_remove};
+
+/**
+ * @brief Inserta un proceso en el monticulo de camino critico
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void cp_enqueue(priority_queue *q, process *p)
+{
+  heap_push(q->critical, p);
+}
+
+/**
+ * @brief Retira el proceso con el camino critico mas largo
+ * @param q Cola de prioridad
+ * @return Proceso con mas trabajo pendiente en su cadena de sucesores
+ */
+static process *cp_pick(priority_queue *q)
+{
+  return (process *)heap_pop(q->critical);
+}
+
+/**
+ * @brief Cantidad de procesos listos
+ * @param q Cola de prioridad
+ * @return Procesos en el monticulo
+ */
+static int cp_count(priority_queue *q)
+{
+  return q->critical->count;
+}
+
+/**
+ * @brief Retira un proceso listo del monticulo
+ * @param q Cola de prioridad
+ * @param p Proceso
+ */
+static void cp_remove(priority_queue *q, process *p)
+{
+  heap_remove(q->critical, p);
+}
+
+const strategy_ops cp_ops = {"CP", cp_enqueue, cp_pick, unbounded_slice, never_expire, cp_enqueue, cp_count, cp_remove};
+
+int nice_weight(int nice)
+{
+  if (nice < -20)
+  {
+    nice = -20;
+  }
+  if (nice > 19)
+  {
+    nice = 19;
+  }
+  return nice_to_weight[nice + 20];
+}
+
+const strategy_ops *get_strategy_ops(strategy s)
+{
+  switch (s)
+  {
+  case FIFO:
+    return &fifo_ops;
+  case SJF:
+    return &sjf_ops;
+  case SRT:
+    return &srt_ops;
+  case CFS:
+    return &cfs_ops;
+  case EDF:
+    return &edf_ops;
+  case LOTTERY:
+    return &lottery_ops;
+  case STRIDE:
+    return &stride_ops;
+  case CP:
+    return &cp_ops;
+  case RR:
+  default:
+    return &rr_ops;
+  }
+}
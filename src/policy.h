@@ -0,0 +1,139 @@
+#ifndef POLICY_H
+#define POLICY_H
+
+/**
+ * @file
+ * @brief Estrategias de planificacion como tablas de operaciones.
+ * @copyright MIT License
+ *
+ * Cada estrategia se define por siete operaciones sobre una cola de
+ * prioridad. El ciclo de simulacion solo usa estas operaciones, de modo que
+ * una nueva estrategia se agrega con una nueva tabla, sin tocar el ciclo.
+ * Las operaciones se definen inline para que los ciclos especializados de
+ * sched.c las expandan sin llamadas indirectas.
+ */
+
+#include <limits.h>
+
+#include "list.h"
+#include "sched.h"
+
+/** @brief Operaciones de una estrategia de planificacion */
+typedef struct strategy_ops
+{
+  const char *name;                                        /*!< Nombre de la estrategia */
+  void (*enqueue)(priority_queue *q, process *p);          /*!< Inserta un proceso que llega a la cola de listos */
+  process *(*pick)(priority_queue *q);                     /*!< Retira el siguiente proceso a ejecutar */
+  int (*slice)(priority_queue *q, process *p);             /*!< Tiempo que el proceso ejecuta antes de revisar on_tick */
+  int (*on_tick)(priority_queue *q, process *p, int used); /*!< 1 si el proceso debe ser expropiado tras used unidades */
+  void (*on_preempt)(priority_queue *q, process *p);       /*!< Devuelve un proceso expropiado a la cola de listos */
+  int (*count)(priority_queue *q);                         /*!< Cantidad de procesos listos */
+  void (*remove)(priority_queue *q, process *p);           /*!< Retira un proceso listo de la cola */
+} strategy_ops;
+
+/** @brief Operaciones de FIFO */
+extern const strategy_ops fifo_ops;
+
+/** @brief Operaciones de SJF */
+extern const strategy_ops sjf_ops;
+
+/** @brief Operaciones de RR */
+extern const strategy_ops rr_ops;
+
+/** @brief Operaciones de SRT */
+extern const strategy_ops srt_ops;
+
+/** @brief Operaciones de CFS */
+extern const strategy_ops cfs_ops;
+
+/** @brief Operaciones de EDF */
+extern const strategy_ops edf_ops;
+
+/** @brief Operaciones de LOTTERY */
+extern const strategy_ops lottery_ops;
+
+/** @brief Operaciones de STRIDE */
+extern const strategy_ops stride_ops;
+
+/** @brief Operaciones de CP */
+extern const strategy_ops cp_ops;
+
+/**
+ * @brief Obtiene la tabla de operaciones de una estrategia
+ * @param s Estrategia
+ * @return Tabla de operaciones
+ */
+const strategy_ops *get_strategy_ops(strategy s);
+
+/**
+ * @brief Obtiene el peso CFS de un valor nice
+ * @param nice Valor nice, entre -20 y 19
+ * @return Peso del proceso (NICE_0_WEIGHT para nice 0)
+ */
+int nice_weight(int nice);
+
+/** @brief Inserta el proceso al final de la cola de listos */
+static inline void fifo_enqueue(priority_queue *q, process *p)
+{
+  push_back(q->ready, p);
+}
+
+/** @brief Inserta el proceso de acuerdo con el tiempo faltante (SJF) */
+static inline void sjf_enqueue(priority_queue *q, process *p)
+{
+  insert_ordered(q->ready, p, compare_sjf);
+}
+
+/** @brief Inserta el proceso de acuerdo con el tiempo faltante (SRT) */
+static inline void srt_enqueue(priority_queue *q, process *p)
+{
+  insert_ordered(q->ready, p, compare_srt);
+}
+
+/** @brief Retira el primer proceso de la cola de listos */
+static inline process *ready_pick(priority_queue *q)
+{
+  process *p;
+
+  p = (process *)front(q->ready);
+  pop_front(q->ready);
+  return p;
+}
+
+/** @brief Cantidad de procesos en la cola de listos */
+static inline int list_count(priority_queue *q)
+{
+  return q->ready->count;
+}
+
+/** @brief Retira un proceso de la cola de listos */
+static inline void list_remove(priority_queue *q, process *p)
+{
+  remove_data(q->ready, p);
+}
+
+/** @brief Las estrategias sin quantum ejecutan hasta terminar */
+static inline int unbounded_slice(priority_queue *q, process *p)
+{
+  return INT_MAX;
+}
+
+/** @brief RR ejecuta como maximo un quantum */
+static inline int quantum_slice(priority_queue *q, process *p)
+{
+  return (q->quantum > 0) ? q->quantum : INT_MAX;
+}
+
+/** @brief Las estrategias sin quantum nunca expropian */
+static inline int never_expire(priority_queue *q, process *p, int used)
+{
+  return 0;
+}
+
+/** @brief RR expropia cuando se consume el quantum */
+static inline int quantum_expire(priority_queue *q, process *p, int used)
+{
+  return q->quantum > 0 && used >= q->quantum;
+}
+
+#endif
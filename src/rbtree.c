@@ -0,0 +1,508 @@
+/**
+ * @file
+ * @brief Arbol rojo-negro (conjunto ordenado generico)
+ * @copyright MIT License
+ */
+
+#include <stdlib.h>
+#include "rbtree.h"
+
+/**
+ * @brief Rota un subarbol hacia la izquierda
+ * @param t Arbol
+ * @param x Raiz del subarbol
+ */
+static void rotate_left(rbtree *t, rb_node *x)
+{
+   rb_node *y;
+
+   y = x->right;
+   x->right = y->left;
+   if (y->left != 0)
+   {
+      y->left->parent = x;
+   }
+   y->parent = x->parent;
+   if (x->parent == 0)
+   {
+      t->root = y;
+   }
+   else if (x == x->parent->left)
+   {
+      x->parent->left = y;
+   }
+   else
+   {
+      x->parent->right = y;
+   }
+   y->left = x;
+   x->parent = y;
+}
+
+/**
+ * @brief Rota un subarbol hacia la derecha
+ * @param t Arbol
+ * @param x Raiz del subarbol
+ */
+static void rotate_right(rbtree *t, rb_node *x)
+{
+   rb_node *y;
+
+   y = x->left;
+   x->left = y->right;
+   if (y->right != 0)
+   {
+      y->right->parent = x;
+   }
+   y->parent = x->parent;
+   if (x->parent == 0)
+   {
+      t->root = y;
+   }
+   else if (x == x->parent->right)
+   {
+      x->parent->right = y;
+   }
+   else
+   {
+      x->parent->left = y;
+   }
+   y->right = x;
+   x->parent = y;
+}
+
+/**
+ * @brief Reemplaza el subarbol u por el subarbol v
+ * @param t Arbol
+ * @param u Subarbol a reemplazar
+ * @param v Nuevo subarbol (puede ser 0)
+ */
+static void transplant(rbtree *t, rb_node *u, rb_node *v)
+{
+   if (u->parent == 0)
+   {
+      t->root = v;
+   }
+   else if (u == u->parent->left)
+   {
+      u->parent->left = v;
+   }
+   else
+   {
+      u->parent->right = v;
+   }
+   if (v != 0)
+   {
+      v->parent = u->parent;
+   }
+}
+
+/**
+ * @brief Obtiene el nodo siguiente en orden
+ * @param n Nodo
+ * @return Nodo siguiente, 0 si n es el ultimo
+ */
+static rb_node *successor(rb_node *n)
+{
+   if (n->right != 0)
+   {
+      n = n->right;
+      while (n->left != 0)
+      {
+         n = n->left;
+      }
+      return n;
+   }
+   while (n->parent != 0 && n == n->parent->right)
+   {
+      n = n->parent;
+   }
+   return n->parent;
+}
+
+/**
+ * @brief Busca el nodo que contiene un dato
+ * @param t Arbol
+ * @param n Raiz del subarbol
+ * @param data Dato
+ * @return Nodo que contiene el dato, 0 si no se encuentra
+ */
+static rb_node *find_node(rbtree *t, rb_node *n, void *data)
+{
+   rb_node *ret;
+   int c;
+
+   while (n != 0)
+   {
+      if (n->data == data)
+      {
+         return n;
+      }
+      c = t->compare(data, n->data);
+      if (c > 0)
+      {
+         n = n->left;
+      }
+      else if (c < 0)
+      {
+         n = n->right;
+      }
+      else
+      {
+         // Las claves iguales pueden quedar a ambos lados tras las rotaciones
+         ret = find_node(t, n->left, data);
+         if (ret != 0)
+         {
+            return ret;
+         }
+         n = n->right;
+      }
+   }
+   return 0;
+}
+
+/**
+ * @brief Restaura las propiedades del arbol tras retirar un nodo negro
+ * @param t Arbol
+ * @param x Nodo que ocupa el lugar del nodo retirado (puede ser 0)
+ * @param parent Padre de x
+ */
+static void erase_fixup(rbtree *t, rb_node *x, rb_node *parent)
+{
+   rb_node *w;
+
+   while (x != t->root && (x == 0 || !x->red))
+   {
+      if (x == parent->left)
+      {
+         w = parent->right;
+         if (w->red)
+         {
+            w->red = 0;
+            parent->red = 1;
+            rotate_left(t, parent);
+            w = parent->right;
+         }
+         if ((w->left == 0 || !w->left->red) && (w->right == 0 || !w->right->red))
+         {
+            w->red = 1;
+            x = parent;
+            parent = x->parent;
+         }
+         else
+         {
+            if (w->right == 0 || !w->right->red)
+            {
+               w->left->red = 0;
+               w->red = 1;
+               rotate_right(t, w);
+               w = parent->right;
+            }
+            w->red = parent->red;
+            parent->red = 0;
+            w->right->red = 0;
+            rotate_left(t, parent);
+            x = t->root;
+         }
+      }
+      else
+      {
+         w = parent->left;
+         if (w->red)
+         {
+            w->red = 0;
+            parent->red = 1;
+            rotate_right(t, parent);
+            w = parent->left;
+         }
+         if ((w->left == 0 || !w->left->red) && (w->right == 0 || !w->right->red))
+         {
+            w->red = 1;
+            x = parent;
+            parent = x->parent;
+         }
+         else
+         {
+            if (w->left == 0 || !w->left->red)
+            {
+               w->right->red = 0;
+               w->red = 1;
+               rotate_left(t, w);
+               w = parent->left;
+            }
+            w->red = parent->red;
+            parent->red = 0;
+            w->left->red = 0;
+            rotate_right(t, parent);
+            x = t->root;
+         }
+      }
+   }
+   if (x != 0)
+   {
+      x->red = 0;
+   }
+}
+
+/**
+ * @brief Retira un nodo del arbol y libera su memoria
+ * @param t Arbol
+ * @param z Nodo a retirar
+ */
+static void erase_node(rbtree *t, rb_node *z)
+{
+   rb_node *x;
+   rb_node *y;
+   rb_node *parent;
+   int removed_red;
+
+   if (t->first == z)
+   {
+      t->first = successor(z);
+   }
+
+   removed_red = z->red;
+   if (z->left == 0)
+   {
+      x = z->right;
+      parent = z->parent;
+      transplant(t, z, z->right);
+   }
+   else if (z->right == 0)
+   {
+      x = z->left;
+      parent = z->parent;
+      transplant(t, z, z->left);
+   }
+   else
+   {
+      // El sucesor ocupa el lugar de z
+      y = z->right;
+      while (y->left != 0)
+      {
+         y = y->left;
+      }
+      removed_red = y->red;
+      x = y->right;
+      if (y->parent == z)
+      {
+         parent = y;
+      }
+      else
+      {
+         parent = y->parent;
+         transplant(t, y, y->right);
+         y->right = z->right;
+         y->right->parent = y;
+      }
+      transplant(t, z, y);
+      y->left = z->left;
+      y->left->parent = y;
+      y->red = z->red;
+   }
+
+   if (!removed_red)
+   {
+      erase_fixup(t, x, parent);
+   }
+
+   t->count--;
+   free(z);
+}
+
+rbtree *create_rbtree(int (*compare)(void *const, void *const))
+{
+   rbtree *ret;
+
+   ret = (rbtree *)malloc(sizeof(rbtree));
+
+   ret->root = 0;
+   ret->first = 0;
+   ret->count = 0;
+   ret->compare = compare;
+   return ret;
+}
+
+/**
+ * @brief Libera un subarbol
+ * @param n Raiz del subarbol
+ * @param erase_data Libera tambien los datos
+ */
+static void free_nodes(rb_node *n, int erase_data)
+{
+   if (n == 0)
+   {
+      return;
+   }
+   free_nodes(n->left, erase_data);
+   free_nodes(n->right, erase_data);
+   if (erase_data)
+   {
+      free(n->data);
+   }
+   free(n);
+}
+
+void clear_rbtree(rbtree *t, int erase_data)
+{
+   if (t == 0)
+   {
+      return;
+   }
+   free_nodes(t->root, erase_data);
+   t->root = 0;
+   t->first = 0;
+   t->count = 0;
+}
+
+void destroy_rbtree(rbtree *t, int erase_data)
+{
+   if (t == 0)
+   {
+      return;
+   }
+   clear_rbtree(t, erase_data);
+   free(t);
+}
+
+rbtree *rb_insert(rbtree *t, void *data)
+{
+   rb_node *n;
+   rb_node *parent;
+   rb_node *g;
+   rb_node *u;
+   rb_node **link;
+   int leftmost;
+
+   if (t == 0)
+   {
+      return 0;
+   }
+
+   // Descender hasta una hoja; los datos iguales van a la derecha
+   parent = 0;
+   link = &t->root;
+   leftmost = 1;
+   while (*link != 0)
+   {
+      parent = *link;
+      if (t->compare(data, parent->data) > 0)
+      {
+         link = &parent->left;
+      }
+      else
+      {
+         link = &parent->right;
+         leftmost = 0;
+      }
+   }
+
+   n = (rb_node *)malloc(sizeof(rb_node));
+   n->data = data;
+   n->left = 0;
+   n->right = 0;
+   n->parent = parent;
+   n->red = 1;
+   *link = n;
+   if (leftmost)
+   {
+      t->first = n;
+   }
+   t->count++;
+
+   // Restaurar las propiedades del arbol
+   while (n->parent != 0 && n->parent->red)
+   {
+      parent = n->parent;
+      g = parent->parent;
+      if (parent == g->left)
+      {
+         u = g->right;
+         if (u != 0 && u->red)
+         {
+            parent->red = 0;
+            u->red = 0;
+            g->red = 1;
+            n = g;
+            continue;
+         }
+         if (n == parent->right)
+         {
+            n = parent;
+            rotate_left(t, n);
+            parent = n->parent;
+         }
+         parent->red = 0;
+         g->red = 1;
+         rotate_right(t, g);
+      }
+      else
+      {
+         u = g->left;
+         if (u != 0 && u->red)
+         {
+            parent->red = 0;
+            u->red = 0;
+            g->red = 1;
+            n = g;
+            continue;
+         }
+         if (n == parent->left)
+         {
+            n = parent;
+            rotate_right(t, n);
+            parent = n->parent;
+         }
+         parent->red = 0;
+         g->red = 1;
+         rotate_left(t, g);
+      }
+   }
+   t->root->red = 0;
+
+   return t;
+}
+
+void *rb_first(const rbtree *t)
+{
+   if (t == 0 || t->first == 0)
+   {
+      return 0;
+   }
+   return t->first->data;
+}
+
+void *rb_pop_first(rbtree *t)
+{
+   void *data;
+
+   if (t == 0 || t->first == 0)
+   {
+      return 0;
+   }
+   data = t->first->data;
+   erase_node(t, t->first);
+   return data;
+}
+
+int rb_remove(rbtree *t, void *data)
+{
+   rb_node *n;
+
+   if (t == 0)
+   {
+      return 0;
+   }
+   n = find_node(t, t->root, data);
+   if (n == 0)
+   {
+      return 0;
+   }
+   erase_node(t, n);
+   return 1;
+}
+
+int rb_empty(const rbtree *t)
+{
+   return t == 0 || t->count == 0;
+}
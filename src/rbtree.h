@@ -0,0 +1,94 @@
+/**
+ * @file
+ * @brief Arbol rojo-negro (conjunto ordenado generico)
+ * @copyright MIT License
+ */
+
+#ifndef _RBTREE_H
+#define _RBTREE_H
+
+/**
+ * @brief Nodo de arbol rojo-negro
+ */
+typedef struct rb_node
+{
+       void *data;             /*!< Apuntador al dato */
+       struct rb_node *left;   /*!< Hijo izquierdo */
+       struct rb_node *right;  /*!< Hijo derecho */
+       struct rb_node *parent; /*!< Nodo padre */
+       int red;                /*!< 1 = nodo rojo, 0 = nodo negro */
+} rb_node;
+
+/**
+ * @brief Arbol rojo-negro de apuntadores.
+ * @note La funcion de comparacion sigue el mismo criterio de insert_ordered:
+ * compare(a, b) > 0 indica que a va antes que b. Los datos con la misma
+ * clave se mantienen en orden de insercion.
+ */
+typedef struct
+{
+       rb_node *root;                             /*!< Raiz del arbol */
+       rb_node *first;                            /*!< Nodo con el primer dato */
+       int count;                                 /*!< Cantidad de elementos */
+       int (*compare)(void *const, void *const); /*!< Funcion de comparacion */
+} rbtree;
+
+/**
+ * @brief Crea un nuevo arbol vacio.
+ * @param compare Funcion de comparacion similar a strcmp
+ * @return Nuevo arbol vacio.
+ */
+rbtree *create_rbtree(int (*compare)(void *const, void *const));
+
+/**
+ * @brief Elimina los nodos del arbol
+ * @param t Arbol a limpiar
+ * @param erase_data 1 = libera la memoria del nodo y el dato, 0, solo libera el nodo.
+ */
+void clear_rbtree(rbtree *t, int erase_data);
+
+/**
+ * @brief Libera la memoria asignada a un arbol y sus nodos
+ * @param t Arbol
+ * @param erase_data Libera tambien los datos
+ */
+void destroy_rbtree(rbtree *t, int erase_data);
+
+/**
+ * @brief Inserta un nuevo dato en el arbol, en O(log n)
+ * @param t Arbol que recibe el nuevo dato
+ * @param data Apuntador al nuevo dato
+ * @return Arbol modificado
+ */
+rbtree *rb_insert(rbtree *t, void *data);
+
+/**
+ * @brief Obtiene el primer dato del arbol, sin retirarlo, en O(1)
+ * @param t Arbol
+ * @return Primer dato, 0 si el arbol se encuentra vacio.
+ */
+void *rb_first(const rbtree *t);
+
+/**
+ * @brief Retira el primer dato del arbol, en O(log n)
+ * @param t Arbol
+ * @return Dato retirado, 0 si el arbol se encuentra vacio.
+ */
+void *rb_pop_first(rbtree *t);
+
+/**
+ * @brief Retira un dato del arbol, en O(log n) si las claves no se repiten
+ * @param t Arbol
+ * @param data Dato a retirar (se compara el apuntador)
+ * @return 1 si el dato se encontraba en el arbol, 0 en caso contrario
+ */
+int rb_remove(rbtree *t, void *data);
+
+/**
+ * @brief Verifica si un arbol se encuentra vacio
+ * @param t Arbol a verificar
+ * @return 1 = arbol vacio, 0 en caso contrario
+ */
+int rb_empty(const rbtree *t);
+
+#endif
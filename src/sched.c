@@ -1,558 +1,1627 @@
-/**
- * @file
- * @brief Planificación de procesos
- * @author Erwin Meza Vega <emezav@unicauca.edu.co>
- *
- */
-
-#include <math.h>
-#include <limits.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
-#include "sched.h"
-
-/**
- * @brief Adiciona el tiempo de espera a los procesos listos
- * @param processes Lista de procesos
- * @param current_process Proceso que tuvo la CPU
- * @param current_time Tiempo actual
- * @param current_slice Cantidad de tiempo que el proceso tuvo la CPU
- */
-void add_waiting_time(list *processes, process *current_process, int current_time, int current_slice);
-
-/**
- * @brief Crea una nueva slice de tiempo
- * @param type Tipo de slice de tiempo (CPU, WAIT)
- * @param from Tiempo de inicio
- * @param to Tiempo de finalizacion
- * @return Nueva slice.
- */
-slice *create_slice(slice_type type, int from, int to);
-
-/**
- * @brief Imprime las asignaciones de CPU y tiempo de espera de un proceso.
- * @param p Proceso a imprimir
- */
-void print_slices(process *p);
-
-/* Rutina para la planificacion.*/
-void schedule(list *processes, priority_queue *queues, int nqueues)
-{
-  int i;
-  list *sequence; // Secuencia de ejecucion
-  sequence_item * si; //Item de secuencia de CPU
-  int total_waiting; //Tiempo total de espera
-  node_iterator it; //Iterador de lista
-  process * p; //Apuntador a un proceso
-
-  // Variables para la simulación
-  int current_time = 0;
-  process *current_process = NULL;
-  int current_quantum = 0;
-  int queue_index = 0;
-  int processes_finished = 0;
-  int total_processes;
-
-  // Preparar para una nueva simulacion
-  prepare(processes, queues, nqueues);
-  sequence = create_list();
-  
-  // Contar total de procesos
-  total_processes = processes->count;
-
-  // Bucle principal de simulación - avanza de 1 en 1
-  while (processes_finished < total_processes) {
-    
-    // PASO 1: Si no hay proceso ejecutándose, seleccionar uno
-    if (current_process == NULL) {
-      // Procesar llegadas ANTES de seleccionar
-      process_arrival(current_time, queues, nqueues);
-      for (i = 0; i < nqueues && current_process == NULL; i++) {
-        if (!empty(queues[i].ready)) {
-          current_process = front(queues[i].ready);
-          pop_front(queues[i].ready);
-          current_process->state = RUNNING;
-          current_quantum = 0; // REINICIAR quantum
-          queue_index = i;
-          printf("[%d] Process %s started/resumed (remaining: %d)\n", 
-                 current_time, current_process->name, current_process->remaining_time);
-        }
-      }
-      
-      // Si no hay procesos, avanzar tiempo
-      if (current_process == NULL) {
-        current_time++;
-        continue;
-      }
-    }
-    
-    // PASO 3: Ejecutar proceso por 1 unidad de tiempo
-    printf("[%d] Process %s executing (quantum: %d/%d, remaining: %d)\n", 
-           current_time, current_process->name, current_quantum + 1, 
-           queues[queue_index].quantum, current_process->remaining_time);
-    
-    current_process->remaining_time--;
-    current_process->cpu_time++;
-    current_quantum++;
-    
-    // Crear slice de CPU
-    push_back(current_process->slices, create_slice(CPU, current_time, current_time + 1));
-    
-    // Agregar tiempo de espera a procesos que están esperando
-    add_waiting_time(processes, current_process, current_time, 1);
-    
-    // Agregar a secuencia (solo si es un nuevo slice o diferente proceso)
-    if (empty(sequence) || strcmp(((sequence_item*)back(sequence))->name, current_process->name) != 0) {
-      si = (sequence_item *)malloc(sizeof(sequence_item));
-      si->name = malloc(strlen(current_process->name) + 1);
-      strcpy(si->name, current_process->name);
-      si->time = 1;
-      push_back(sequence, si);
-    } else {
-      // Incrementar tiempo del último slice
-      ((sequence_item*)back(sequence))->time++;
-    }
-    
-    // PASO 4: Avanzar tiempo
-    current_time++;
-    
-    // PASO 5: Verificar si proceso terminó
-    if (current_process->remaining_time <= 0) {
-      current_process->state = FINISHED;
-      current_process->finished_time = current_time;
-      push_back(queues[queue_index].finished, current_process);
-      printf("[%d] Process %s finished\n", current_time, current_process->name);
-      current_process = NULL;
-      processes_finished++;
-    }
-    // PASO 6: Verificar preempción por quantum en RR
-    else if (queues[queue_index].strategy == RR && 
-             queues[queue_index].quantum > 0 && 
-             current_quantum >= queues[queue_index].quantum) {
-      // Hacer preempción por quantum - el proceso va AL FINAL
-      current_process->state = READY;
-      push_back(queues[queue_index].ready, current_process);
-      printf("[%d] Process %s preempted (quantum expired, remaining: %d)\n", 
-             current_time, current_process->name, current_process->remaining_time);
-      current_process = NULL;
-    }
-  }
-
-  // Calcular tiempos de espera finales
-  for (it = head(processes); it != 0; it = next(it)) {
-    p = (process *)it->data;
-    int total_wait = 0;
-    node_iterator slice_it;
-    slice *s;
-    for (slice_it = head(p->slices); slice_it != 0; slice_it = next(slice_it)) {
-      s = (slice *)slice_it->data;
-      if (s->type == WAIT) {
-        total_wait += (s->to - s->from);
-      }
-    }
-    p->waiting_time = total_wait;
-  }
-
-  // Imprimir resultados
-  for (i = 0; i < nqueues; i++)
-  {
-    print_queue(&queues[i]);
-  }
-  printf("%5s%20s%5s%5s%5s\n", "#", "Process", "Arr.", "Fin.", "Wait");
-  i = 1;
-  total_waiting = 0;
-  for (it = head(processes); it != 0; it = next(it))
-  {
-    p = (process *)it->data;
-    printf("%5d%20s%5d%5d%5d\n", i++, p->name, p->arrival_time, p->finished_time, p->waiting_time);
-    total_waiting = total_waiting + p->waiting_time;
-  }
-
-  printf("\nTotal waiting time: %d Average waiting time: %.3f\n", total_waiting, (float)((float)total_waiting / (int)processes->count));
-
-  for (it = head(sequence); it != 0; it = next(it))
-  {
-    si = (sequence_item *)it->data;
-    printf("%s (%d) ", si->name, si->time);
-  }
-  printf("\n");
-}
-priority_queue *create_queues(int n)
-{
-  priority_queue *ret;
-  int i;
-
-  ret = (priority_queue *)malloc(sizeof(priority_queue) * n);
-
-  for (i = 0; i < n; i++)
-  {
-    ret[i].strategy = RR; // Por defecto RR
-    ret[i].quantum = 0;
-    ret[i].arrival = create_list();
-    ret[i].ready = create_list();
-    ret[i].finished = create_list();
-  }
-
-  return ret;
-}
-
-void print_queue(priority_queue *queue)
-{
-  //int i;
-  node_iterator ptr;
-
-  printf("%s q=",
-         (queue->strategy == RR) ? "RR" : ((queue->strategy == FIFO) ? "FIFO" : ((queue->strategy == SJF) ? "SJF" : ((queue->strategy == SRT) ? "SRT" : "UNKNOWN"))));
-  printf("%d ", queue->quantum);
-
-  printf("ready (%d): { ", queue->ready->count);
-
-  for (ptr = head(queue->ready); ptr != 0; ptr = next(ptr))
-  {
-    print_process((process *)ptr->data);
-  }
-
-  printf("} \n");
-
-  printf("arrival (%d): { ", queue->arrival->count);
-
-  for (ptr = head(queue->arrival); ptr != 0; ptr = next(ptr))
-  {
-    print_process((process *)ptr->data);
-  }
-
-  printf("} \n");
-
-  printf("finished (%d): { ", queue->finished->count);
-
-  for (ptr = head(queue->finished); ptr != 0; ptr = next(ptr))
-  {
-    print_process((process *)ptr->data);
-  }
-  printf("}\n");
-}
-
-int compare_arrival(void *const a, void *const b)
-{
-  process *p1;
-  process *p2;
-
-  p1 = (process *)a;
-  p2 = (process *)b;
-
-  // printf("Comparing %s to %s : %d %d\n", p1->name, p2->name, p1->arrival_time, p2->arrival_time);
-
-  return p2->arrival_time - p1->arrival_time;
-}
-
-int compare_sjf(void *const a, void *const b)
-{
-  process *p1;
-  process *p2;
-  int result;
-
-  p1 = (process *)a;
-  p2 = (process *)b;
-
-  // Si el otro proceso ya recibio la CPUel otro tiene prioridad
-  if (p2->cpu_time > 0)
-  {
-    result = -1;
-  }
-  else
-  {
-    result = p2->remaining_time - p1->remaining_time;
-  }
-
-  return result;
-}
-
-int compare_srt(void *const a, void *const b)
-{
-  process *p1;
-  process *p2;
-
-  int result;
-
-  p1 = (process *)a;
-  p2 = (process *)b;
-
-  // Si el otro proceso ya recibio la CPU y el nuevo no, el otro tiene prioridad
-  result = p2->remaining_time - p1->remaining_time;
-
-  return result;
-}
-
-process *create_process(char *name, int arrival_time, int execution_time)
-{
-
-  process *p;
-
-  // Reservar memoria para el proceso
-  p = (process *)malloc(sizeof(process));
-
-  memset(p, 0, sizeof(process));
-  strcpy(p->name, name);
-  p->arrival_time = arrival_time;
-  p->execution_time = execution_time;
-  p->priority = -1;
-  p->waiting_time = -1;
-  p->remaining_time = p->execution_time;
-  p->finished_time = -1;
-  p->cpu_time = 0;
-  p->state = LOADED;
-  p->slices = create_list();
-
-  return p;
-}
-
-void restart_process(process *p)
-{
-
-  p->waiting_time = -1;
-  p->finished_time = -1;
-  p->remaining_time = p->execution_time;
-  p->state = LOADED;
-  clear_list(p->slices, 1);
-}
-
-void print_slices(process *p)
-{
-  node_iterator it;
-  slice *s;
-
-  for (it = head(p->slices); it != 0; it = next(it))
-  {
-    s = it->data;
-    printf("%s %d -> %d ", (s->type == CPU ? "CPU" : "WAIT"), s->from, s->to);
-  }
-}
-
-void print_process(process *p)
-{
-  if (p == 0)
-  {
-    return;
-  }
-  printf("(%s arrival:%d execution:%d finished:%d waiting:%d ",
-         p->name, p->arrival_time, p->execution_time, p->finished_time, p->waiting_time);
-  // UNDEFINED, LOADED, READY, RUNNING, FINISHED
-  printf("%s )\n", (p->state == READY) ? "ready" : (p->state == LOADED) ? "loaded"
-                                               : (p->state == FINISHED) ? "finished"
-                                                                        : "unknown");
-}
-
-void prepare(list *processes, priority_queue *queues, int nqueues)
-{
-  int i;
-  process *p;
-  node_iterator it;
-
-  /* Limpiar las colas de prioridad */
-
-  for (i = 0; i < nqueues; i++)
-  {
-    // printf("Clearing queue %d\n", i);
-    if (queues[i].ready != 0)
-    {
-      clear_list(queues[i].ready, 0);
-      queues[i].ready = create_list();
-    }
-    if (queues[i].arrival != 0)
-    {
-      clear_list(queues[i].arrival, 0);
-      queues[i].arrival = create_list();
-    }
-    if (queues[i].finished != 0)
-    {
-      clear_list(queues[i].finished, 0);
-      queues[i].finished = create_list();
-    }
-  }
-
-  /* Inicializar la informacion de los procesos en la lista de procesos */
-  for (it = head(processes); it != 0; it = next(it))
-  {
-    p = (process *)it->data;
-    restart_process(p);
-    insert_ordered(queues[p->priority].arrival, p, compare_arrival);
-  }
-
-  printf("Prepared queues:\n");
-  for (i=0; i<nqueues; i++) {
-    print_queue(&queues[i]);
-  }
-}
-
-int process_arrival(int now, priority_queue *queues, int nqueues)
-{
-  int i;
-  process *p;
-  //process *aux;
-  int queue_processed;
-  int total;
-
-  // Procesar llegadas.
-  total = 0;
-  for (i = 0; i < nqueues; i++)
-  {
-
-    // printf("Queue %d\n", i);
-    if (empty(queues[i].arrival))
-    {
-      // Pasar a la siguiente cola.
-      continue;
-    }
-
-    queue_processed = 0;
-    do
-    {
-      // Procesar las llegadas de nuevos procesos
-      p = front(queues[i].arrival);
-
-      if (p == 0)
-      {
-        queue_processed = 1;
-        continue;
-      }
-
-      // Ignorar el proceso si no es momento de llevarlo a la cola de listos
-      if (p->arrival_time > now)
-      {
-        queue_processed = 1;
-        continue;
-      }
-
-      printf("[%d] Process %s arrived at %d.\n", now, p->name, p->arrival_time);
-      p->state = READY;
-      p->waiting_time = now - p->arrival_time;
-
-      // Dibujar la linea del tiempo de espera
-      if (p->waiting_time > 0)
-      {
-        push_back(p->slices, create_slice(WAIT, p->arrival_time, now));
-      }
-
-      total++;
-
-      if (queues[i].strategy == SJF)
-      {
-        // Para SJF y SRT, el proceso se inserta de acuerdo con el tiempo faltante
-        insert_ordered(queues[i].ready, p, compare_sjf);
-      }
-      else if (queues[i].strategy == SJF || queues[i].strategy == SRT)
-      {
-        // Para SJF y SRT, el proceso se inserta de acuerdo con el tiempo faltante
-        insert_ordered(queues[i].ready, p, compare_srt);
-      }
-      else
-      {
-        // Para los demas algoritmos, el nuevo proceso se inserta al final de la cola de listos
-        push_back(queues[i].ready, p);
-      }
-
-      // Quitar el proceso de la cola de llegadas
-      pop_front(queues[i].arrival);
-
-    } while (!queue_processed);
-  }
-  // Retorna el numero de procesos que se pasaron a las colas de listos
-  return total;
-}
-
-int get_next_arrival(priority_queue *queues, int nqueues)
-{
-  int ret;
-  process *p;
-  int i;
-  int arrival_time;
-  //int min_time;
-
-  ret = INT_MAX;
-  arrival_time = ret;
-
-  for (i = 0; i < nqueues; i++)
-  {
-    // Revisar el primer proceso en la cola de listos
-    p = front(queues[i].arrival);
-    if (p != 0)
-    {
-      arrival_time = p->arrival_time;
-      ret = min(ret, arrival_time);
-    }
-  }
-
-  // printf("Next arrival : %d\n", ret);
-
-  if (ret == INT_MAX)
-  {
-    ret = -1;
-  }
-
-  return ret;
-}
-
-int get_ready_count(priority_queue *queues, int nqueues)
-{
-  int ret;
-  int i;
-
-  ret = 0;
-
-  for (i = 0; i < nqueues; i++)
-  {
-    ret = ret + queues[i].ready->count;
-  }
-  return ret;
-}
-
-int max_scheduling_time(list *processes)
-{
-  //int process_total;
-  node_iterator it;
-  process *p;
-  int max;
-
-  max = 0;
-
-  // Calcular el tiempo como la suma de los tiempos de ejecucion de los procesos.
-  for (it = head(processes); it != 0; it = next(it))
-  {
-    p = (process *)it->data;
-    // Sumar el tiempo total de CPU y lock
-    if (p->finished_time > max)
-    {
-      max = p->finished_time;
-    }
-  }
-
-  return max;
-}
-
-void add_waiting_time(list *processes, process *current_process, int current_time, int current_slice)
-{
-  node_iterator it;
-  process *p;
-  for (it = head(processes); it != 0; it = next(it))
-  {
-    p = (process *)it->data;
-    if (p != current_process && p->state == READY)
-    {
-      p->waiting_time += current_slice;
-      push_back(p->slices, create_slice(WAIT, current_time, current_time + current_slice));
-    }
-  }
-}
-
-slice *create_slice(slice_type type, int from, int to)
-{
-  slice *s;
-
-  s = (slice *)malloc(sizeof(slice));
-  s->type = type;
-  s->from = from;
-  s->to = to;
-  return s;
-}
+/**
+ * @file
+ * @brief Planificación de procesos
+ * @author Erwin Meza Vega <emezav@unicauca.edu.co>
+ *
+ */
+
+#include <math.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cgroup.h"
+#include "client.h"
+#include "dag.h"
+#include "deadline.h"
+#include "latency.h"
+#include "policy.h"
+#include "sched.h"
+#include "share.h"
+#include "stats.h"
+#include "timeseries.h"
+#include "traceexport.h"
+#include "util.h"
+
+/**
+ * @brief Crea una nueva slice de tiempo
+ * @param type Tipo de slice de tiempo (CPU, WAIT)
+ * @param from Tiempo de inicio
+ * @param to Tiempo de finalizacion
+ * @return Nueva slice.
+ */
+slice *create_slice(slice_type type, int from, int to);
+
+/**
+ * @brief Registra una slice de tiempo de un proceso, extendiendo la ultima
+ * slice si es del mismo tipo y continua en el tiempo.
+ * @param p Proceso
+ * @param type Tipo de slice de tiempo (CPU, WAIT)
+ * @param from Tiempo de inicio
+ * @param to Tiempo de finalizacion
+ */
+void add_slice(process *p, slice_type type, int from, int to);
+
+/**
+ * @brief Imprime las asignaciones de CPU y tiempo de espera de un proceso.
+ * @param p Proceso a imprimir
+ */
+void print_slices(process *p);
+
+/**
+ * @brief Marca un proceso como listo y programa su envejecimiento
+ * @param p Proceso
+ * @param now Tiempo actual
+ * @param wheel Rueda de tiempo
+ * @param config Parametros de la simulacion
+ */
+static void make_ready(process *p, int now, timing_wheel *wheel, const sched_config *config)
+{
+  p->state = READY;
+  p->ready_since = now;
+  if (config->aging > 0 && p->priority > 0)
+  {
+    p->aging_timer = wheel_schedule(wheel, now + config->aging, EV_AGING, p);
+  }
+}
+
+/**
+ * @brief Divide el tiempo listo de un proceso en espera hasta a y THROTTLED entre a y b
+ * @param p Proceso listo
+ * @param from Inicio del tiempo listo sin registrar; avanza hasta b
+ * @param a Inicio del intervalo en el que su grupo de control agoto su cuota
+ * @param b Fin del intervalo
+ */
+static void add_throttled(process *p, int *from, int a, int b)
+{
+  a = max(a, *from);
+  if (a >= b)
+  {
+    return;
+  }
+  if (a > *from)
+  {
+    p->waiting_time += a - *from;
+    add_slice(p, WAIT, *from, a);
+  }
+  p->throttled_time += b - a;
+  add_slice(p, THROTTLED, a, b);
+  *from = b;
+}
+
+/**
+ * @brief Registra el tiempo que un proceso estuvo listo desde ready_since.
+ * Mientras su grupo de control agoto su cuota, el tiempo no es espera sino THROTTLED.
+ * @param queues Arreglo de colas de prioridad
+ * @param p Proceso listo
+ * @param now Tiempo actual
+ */
+static void account_wait(priority_queue *queues, process *p, int now)
+{
+  control_group *g;
+  node_iterator it;
+  slice *s;
+  int from;
+
+  if (now <= p->ready_since)
+  {
+    return;
+  }
+  from = p->ready_since;
+  if (queues[p->priority].cgroups != NULL)
+  {
+    g = &queues[p->priority].cgroups[p->cgroup];
+
+    // Los intervalos estan en orden: retroceder hasta el ultimo que termina antes de from
+    for (it = tail(g->throttles); it != 0 && ((slice *)it->data)->to > from; it = previous(it))
+      ;
+    for (it = (it != 0) ? next(it) : head(g->throttles); it != 0; it = next(it))
+    {
+      s = (slice *)it->data;
+      add_throttled(p, &from, s->from, min(s->to, now));
+    }
+    // Si el grupo sigue agotado, el intervalo abierto termina en el tiempo actual
+    if (g->depth > 0)
+    {
+      add_throttled(p, &from, g->blocked_since, now);
+    }
+  }
+  if (now > from)
+  {
+    p->waiting_time += now - from;
+    add_slice(p, WAIT, from, now);
+  }
+}
+
+/**
+ * @brief Sube un proceso listo a la cola anterior cuando cumple el umbral de envejecimiento
+ * @param queues Arreglo de colas de prioridad
+ * @param p Proceso
+ * @param now Tiempo actual
+ * @param wheel Rueda de tiempo
+ * @param config Parametros de la simulacion
+ * @param counters Contadores de la simulacion
+ */
+static void age_process(priority_queue *queues, process *p, int now, timing_wheel *wheel,
+                        const sched_config *config, sched_counters *counters)
+{
+  p->aging_timer = NULL;
+  if (p->state != READY || p->priority == 0)
+  {
+    return;
+  }
+
+  // El tiempo de espera en la cola anterior se registra antes de cambiar de cola
+  queues[p->priority].ops->remove(&queues[p->priority], p);
+  STATS_COUNT(pops);
+  account_wait(queues, p, now);
+  p->priority--;
+  queues[p->priority].ops->enqueue(&queues[p->priority], p);
+  STATS_COUNT(inserts);
+  make_ready(p, now, wheel, config);
+  counters->promotions++;
+  trace(config, "[%d] Process %s promoted to queue %d\n", now, p->name, p->priority + 1);
+}
+
+/**
+ * @brief Sube todos los procesos listos a la primera cola
+ * @param queues Arreglo de colas de prioridad
+ * @param nqueues Cantidad de colas de prioridad
+ * @param cpus Procesadores; sus procesos en ejecucion tambien suben
+ * @param ncpus Cantidad de procesadores
+ * @param now Tiempo actual
+ * @param config Parametros de la simulacion
+ * @param counters Contadores de la simulacion
+ */
+static void boost_queues(priority_queue *queues, int nqueues, processor *cpus, int ncpus, int now,
+                         const sched_config *config, sched_counters *counters)
+{
+  int i;
+  process *p;
+
+  for (i = 1; i < nqueues; i++)
+  {
+    while (queues[i].ops->count(&queues[i]) > 0)
+    {
+      p = queues[i].ops->pick(&queues[i]);
+      if (p == NULL)
+      {
+        break;
+      }
+      p->priority = 0;
+      queues[0].ops->enqueue(&queues[0], p);
+      STATS_COUNT(pops);
+      STATS_COUNT(inserts);
+    }
+  }
+  // Los procesos en ejecucion terminan su tramo, pero vuelven a la primera cola
+  for (i = 0; i < ncpus; i++)
+  {
+    if (cpus[i].current != NULL)
+    {
+      cpus[i].current->priority = 0;
+    }
+  }
+  counters->boosts++;
+  trace(config, "[%d] Priority boost\n", now);
+}
+
+/**
+ * @brief Registra el tiempo de CPU del proceso de un procesador y lo agrega a la secuencia
+ * @param queues Arreglo de colas de prioridad
+ * @param c Procesador; su proceso ejecuto desde c->dispatch_time
+ * @param sequence Secuencia de ejecucion
+ * @param to Tiempo en el que el proceso deja la CPU
+ * @param config Configuracion de la simulacion
+ */
+static void account_cpu(priority_queue *queues, processor *c, list *sequence, int to, const sched_config *config)
+{
+  sequence_item *si;
+  priority_queue *home;
+  process *p;
+  int from;
+  int used;
+
+  p = c->current;
+  from = c->dispatch_time;
+  used = to - from;
+  c->busy_time += used;
+  if (p->home >= 0 && c->socket != p->home)
+  {
+    p->remote_time += used;
+  }
+  p->remaining_time -= used;
+  p->burst_left -= used;
+  p->cpu_time += used;
+  add_slice(p, CPU, from, to);
+  export_cpu_slice(c->id, p, CPU, from, to);
+  p->last_run = to;
+
+  // Tiempo virtual: avanza mas lento para los procesos con mayor peso (CFS)
+  p->vruntime += (long long)used * NICE_0_WEIGHT * VRUNTIME_SCALE / p->weight;
+
+  // Valor de paso: avanza mas lento para los procesos con mas boletos (STRIDE)
+  p->pass += (long long)used * STRIDE1 / p->tickets;
+
+  // Cada boleto activo de la cola de origen tiene derecho a la misma fraccion de la CPU recibida
+  home = &queues[p->base_priority];
+  if (home->active_tickets > 0)
+  {
+    home->ticket_clock += (double)used / home->active_tickets;
+  }
+
+  // La CPU se descuenta de la cuota de los grupos de control del proceso
+  if (home->cgroups != NULL)
+  {
+    charge_cgroups(home, p, used, to, config);
+  }
+
+  // Agregar a secuencia (solo si es un nuevo slice o diferente proceso)
+  // Los nombres estan internados: basta con comparar los apuntadores
+  if (empty(sequence) || ((sequence_item *)back(sequence))->name != p->name)
+  {
+    si = (sequence_item *)malloc(sizeof(sequence_item));
+    si->name = p->name;
+    si->time = used;
+    push_back(sequence, si);
+  }
+  else
+  {
+    ((sequence_item *)back(sequence))->time += used;
+  }
+}
+
+/**
+ * @brief Acumula la CPU que correspondia a los boletos de un proceso que se bloquea o termina
+ * @param queues Arreglo de colas de prioridad
+ * @param p Proceso que deja de competir por la CPU
+ */
+static void leave_share(priority_queue *queues, process *p)
+{
+  priority_queue *home;
+
+  home = &queues[p->base_priority];
+  p->entitled += p->tickets * (home->ticket_clock - p->ticket_clock);
+  home->active_tickets -= p->tickets;
+}
+
+/**
+ * @brief Descuenta un proceso que termina del grado de entrada de sus sucesores.
+ * Un sucesor sin predecesores pendientes llega en su tiempo de llegada, o despues de su tiempo de
+ * reflexion si es posterior.
+ * @param p Proceso que termina
+ * @param now Tiempo actual
+ * @param wheel Rueda de tiempo que recibe las llegadas
+ */
+static void release_successors(process *p, int now, timing_wheel *wheel)
+{
+  process *s;
+  int i;
+
+  for (i = 0; i < p->nsuccessors; i++)
+  {
+    s = p->successors[i];
+    if (--s->pending == 0)
+    {
+      s->released = max(s->arrival_time, now + s->think);
+      s->ready_since = s->released;
+      wheel_schedule(wheel, s->released, EV_ARRIVAL, s);
+    }
+  }
+}
+
+/**
+ * @brief Asigna un dispositivo libre a un proceso bloqueado
+ * @param d Dispositivo
+ * @param p Proceso bloqueado
+ * @param now Tiempo actual
+ * @param wheel Rueda de tiempo
+ */
+static void start_io(io_device *d, process *p, int now, timing_wheel *wheel)
+{
+  d->current = p;
+  d->queued_time += now - p->blocked_since;
+  d->requests++;
+  wheel_schedule(wheel, now + p->bursts[p->burst], EV_IO, p);
+}
+
+/**
+ * @brief Bloquea un proceso que termino su rafaga de CPU hasta completar su rafaga de E/S
+ * @param queues Arreglo de colas de prioridad
+ * @param devices Dispositivos de E/S
+ * @param p Proceso
+ * @param now Tiempo actual
+ * @param wheel Rueda de tiempo
+ */
+static void block_process(priority_queue *queues, io_device *devices, process *p, int now, timing_wheel *wheel,
+                          const sched_config *config)
+{
+  io_device *d;
+
+  p->state = BLOCKED;
+  p->burst++;
+  p->blocked_since = now;
+  leave_share(queues, p);
+  trace(config, "[%d] Process %s blocked on device %d (I/O: %d, remaining: %d)\n",
+        now, p->name, p->device + 1, p->bursts[p->burst], p->remaining_time);
+
+  d = &devices[p->device];
+  if (d->current == NULL)
+  {
+    start_io(d, p, now, wheel);
+  }
+  else
+  {
+    push_back(d->queue, p);
+  }
+}
+
+/**
+ * @brief Termina la rafaga de E/S de un proceso y atiende al siguiente proceso del dispositivo
+ * @param devices Dispositivos de E/S
+ * @param p Proceso que completa su E/S
+ * @param now Tiempo actual
+ * @param wheel Rueda de tiempo
+ * @param config Parametros de la simulacion
+ */
+static void complete_io(io_device *devices, process *p, int now, timing_wheel *wheel, const sched_config *config)
+{
+  io_device *d;
+  process *next_process;
+
+  d = &devices[p->device];
+  d->busy_time += p->bursts[p->burst];
+  d->current = NULL;
+  add_slice(p, IO, p->blocked_since, now);
+  trace(config, "[%d] Process %s finished I/O\n", now, p->name);
+
+  // La siguiente rafaga es de CPU; el proceso espera su admision desde ahora
+  p->burst++;
+  p->burst_left = p->bursts[p->burst];
+  p->ready_since = now;
+
+  if (!empty(d->queue))
+  {
+    next_process = (process *)front(d->queue);
+    pop_front(d->queue);
+    start_io(d, next_process, now, wheel);
+  }
+}
+
+/**
+ * @brief Agrega el costo del cambio de contexto, la recarga de la cache y la migracion al asignar la CPU
+ * @param cpus Procesadores de la topologia
+ * @param c Procesador asignado
+ * @param p Proceso que recibe la CPU
+ * @param now Tiempo actual
+ * @param config Parametros de la simulacion
+ * @param counters Contadores de la simulacion
+ * @return Tiempo de CPU perdido antes de que el proceso ejecute
+ */
+static int dispatch_overhead(processor *cpus, processor *c, process *p, int now, const sched_config *config,
+                             sched_counters *counters)
+{
+  int overhead;
+  int reload;
+
+  overhead = 0;
+  STATS_COUNT(dispatches);
+  if (p != c->last)
+  {
+    counters->switches++;
+    STATS_COUNT(switches);
+    if (config->switch_cost > 0)
+    {
+      overhead = config->switch_cost;
+      counters->switch_time += overhead;
+      add_slice(p, SWITCH, now, now + overhead);
+      export_cpu_slice(c->id, p, SWITCH, now, now + overhead);
+    }
+  }
+
+  reload = reload_penalty(config, (p->last_run < 0) ? -1 : now - p->last_run);
+  if (reload > 0)
+  {
+    counters->reload_time += reload;
+    add_slice(p, RELOAD, now + overhead, now + overhead + reload);
+    export_cpu_slice(c->id, p, RELOAD, now + overhead, now + overhead + reload);
+    overhead += reload;
+  }
+
+  // Cambiar de socket obliga a traer la memoria del proceso desde el otro nodo
+  if (p->cpu >= 0 && cpus[p->cpu].socket != c->socket)
+  {
+    p->migrations++;
+    counters->migrations++;
+    if (config->migration_cost > 0)
+    {
+      counters->migration_time += config->migration_cost;
+      add_slice(p, MIGRATE, now + overhead, now + overhead + config->migration_cost);
+      export_cpu_slice(c->id, p, MIGRATE, now + overhead, now + overhead + config->migration_cost);
+      overhead += config->migration_cost;
+    }
+  }
+  return overhead;
+}
+
+/**
+ * @brief Elige el procesador libre en el que ejecuta un proceso
+ * @param cpus Procesadores de la topologia
+ * @param ncpus Cantidad de procesadores, al menos uno libre
+ * @param p Proceso
+ * @param config Parametros de la simulacion (politica de ubicacion)
+ * @return Procesador libre elegido
+ */
+static processor *place_process(processor *cpus, int ncpus, process *p, const sched_config *config)
+{
+  int busy[MAX_SOCKETS];
+  int idle[MAX_SOCKETS];
+  int last;
+  int best;
+  int socket;
+  int i;
+
+  for (socket = 0; socket < config->sockets; socket++)
+  {
+    busy[socket] = 0;
+    idle[socket] = 0;
+  }
+  for (i = 0; i < ncpus; i++)
+  {
+    if (cpus[i].current != NULL)
+    {
+      busy[cpus[i].socket]++;
+    }
+    else
+    {
+      idle[cpus[i].socket]++;
+    }
+  }
+
+  // local: el socket de afinidad, o el socket en el que ya esta el proceso, evita migrar
+  best = -1;
+  last = (p->cpu >= 0) ? cpus[p->cpu].socket : -1;
+  if (config->placement == PLACE_LOCAL)
+  {
+    if (p->home >= 0 && idle[p->home] > 0)
+    {
+      best = p->home;
+    }
+    else if (last >= 0 && idle[last] > 0)
+    {
+      best = last;
+    }
+  }
+
+  // spread: el socket menos ocupado; pack: el mas ocupado con un procesador libre
+  for (socket = 0; socket < config->sockets && (best < 0 || config->placement != PLACE_LOCAL); socket++)
+  {
+    if (idle[socket] == 0)
+    {
+      continue;
+    }
+    if (best < 0 ||
+        (config->placement == PLACE_SPREAD && busy[socket] < busy[best]) ||
+        (config->placement == PLACE_PACK && busy[socket] > busy[best]))
+    {
+      best = socket;
+    }
+  }
+
+  if (p->home < 0)
+  {
+    p->home = best;
+  }
+
+  // El ultimo procesador del proceso conserva su cache
+  if (last == best && cpus[p->cpu].current == NULL)
+  {
+    return &cpus[p->cpu];
+  }
+  for (i = 0; i < ncpus; i++)
+  {
+    if (cpus[i].current == NULL && cpus[i].socket == best)
+    {
+      break;
+    }
+  }
+  return &cpus[i];
+}
+
+/**
+ * @brief Crea los procesadores de la topologia
+ * @param config Parametros de la simulacion (sockets y procesadores por socket)
+ * @return Arreglo de sockets * cores procesadores libres
+ */
+static processor *create_processors(const sched_config *config)
+{
+  processor *ret;
+  int i;
+
+  ret = (processor *)malloc(sizeof(processor) * config->sockets * config->cores);
+  for (i = 0; i < config->sockets * config->cores; i++)
+  {
+    ret[i].id = i;
+    ret[i].socket = i / config->cores;
+    ret[i].current = NULL;
+    ret[i].queue = NULL;
+    ret[i].last = NULL;
+    ret[i].slice_end = NULL;
+    ret[i].dispatch_time = 0;
+    ret[i].busy_time = 0;
+  }
+  return ret;
+}
+
+/**
+ * @brief Crea los dispositivos de E/S
+ * @param n Cantidad de dispositivos
+ * @return Arreglo de dispositivos libres
+ */
+static io_device *create_devices(int n)
+{
+  io_device *ret;
+  int i;
+
+  ret = (io_device *)malloc(sizeof(io_device) * n);
+  for (i = 0; i < n; i++)
+  {
+    ret[i].queue = create_list();
+    ret[i].current = NULL;
+    ret[i].busy_time = 0;
+    ret[i].queued_time = 0;
+    ret[i].requests = 0;
+  }
+  return ret;
+}
+
+/**
+ * @brief Libera los dispositivos de E/S
+ * @param devices Arreglo de dispositivos
+ * @param n Cantidad de dispositivos
+ */
+static void destroy_devices(io_device *devices, int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+  {
+    destroy_list(devices[i].queue, 0);
+  }
+  free(devices);
+}
+
+/**
+ * @brief Imprime la utilizacion de los procesadores y de los dispositivos de E/S usados
+ * @param table Tabla de procesos simulados
+ * @param devices Dispositivos de E/S
+ * @param ndevices Cantidad de dispositivos
+ * @param cpus Procesadores de la topologia
+ * @param config Parametros de la simulacion
+ * @param counters Contadores de la simulacion
+ */
+static void print_utilization(process_table *table, io_device *devices, int ndevices, processor *cpus,
+                              const sched_config *config, sched_counters *counters)
+{
+  process *p;
+  long busy;
+  long overhead;
+  long capacity;
+  int makespan;
+  int ncpus;
+  int i;
+
+  busy = 0;
+  makespan = 0;
+  for (i = 0; i < table->count; i++)
+  {
+    p = table_process(table, i);
+    busy += p->cpu_time;
+    makespan = max(makespan, p->finished_time);
+  }
+  if (makespan <= 0)
+  {
+    return;
+  }
+
+  ncpus = config->sockets * config->cores;
+  capacity = (long)makespan * ncpus;
+  printf("CPU utilization: %.1f%% (%ld of %ld time units)\n", 100.0 * busy / capacity, busy, capacity);
+  overhead = counters->switch_time + counters->reload_time + counters->migration_time;
+  if (overhead > 0)
+  {
+    printf("Overhead: %ld time units in %d context switches (switch: %ld, cache reload: %ld, migration: %ld), %.1f%% of the CPU time\n",
+           overhead, counters->switches, counters->switch_time, counters->reload_time,
+           counters->migration_time, 100.0 * overhead / capacity);
+  }
+  for (i = 0; i < ndevices; i++)
+  {
+    if (devices[i].requests > 0)
+    {
+      printf("Device %d utilization: %.1f%% (%d requests, average queueing %.3f)\n", i + 1,
+             100.0 * devices[i].busy_time / makespan, devices[i].requests,
+             (double)devices[i].queued_time / devices[i].requests);
+    }
+  }
+  if (ncpus == 1)
+  {
+    return;
+  }
+
+  printf("\nTopology: %d sockets x %d cores, placement %s, %d migrations\n", config->sockets, config->cores,
+         (config->placement == PLACE_SPREAD) ? "spread" : (config->placement == PLACE_PACK) ? "pack" : "local",
+         counters->migrations);
+  for (i = 0; i < ncpus; i++)
+  {
+    printf("CPU %d (socket %d) utilization: %.1f%%\n", i + 1, cpus[i].socket + 1, 100.0 * cpus[i].busy_time / makespan);
+  }
+  if (config->quiet)
+  {
+    return;
+  }
+  printf("%5s%20s%6s%6s%11s%8s\n", "#", "Process", "Home", "CPU", "Migrations", "Remote");
+  for (i = 0; i < table->count; i++)
+  {
+    p = table_process(table, i);
+    printf("%5d%20s%6d%6d%11d%8d\n", i + 1, p->name, p->home + 1, p->cpu_time, p->migrations, p->remote_time);
+  }
+}
+
+/**
+ * @brief Obtiene el grupo cuyos hilos deben ejecutar simultaneamente
+ * @param table Tabla de procesos
+ * @param p Proceso
+ * @param ncpus Cantidad de procesadores
+ * @param config Parametros de la simulacion
+ * @return Grupo del proceso, NULL si el proceso se planifica de forma independiente
+ */
+static process_group *gang_of(process_table *table, process *p, int ncpus, const sched_config *config)
+{
+  process_group *g;
+
+  if (p->group < 0 || !config->gang)
+  {
+    return NULL;
+  }
+  g = &table->groups[p->group];
+  // Un grupo con mas hilos que procesadores, o que unidades de cuota de su grupo de control, nunca podria ejecutar
+  return (g->gang && g->size <= ncpus && g->size <= cgroup_limit(table, p->cgroup)) ? g : NULL;
+}
+
+/**
+ * @brief Retira el siguiente hilo que espera a su grupo
+ * @param g Grupo con hilos en espera
+ * @return Hilo retirado, todavia en estado PARKED
+ */
+static process *unpark_thread(process_group *g)
+{
+  int i;
+
+  for (i = 0; g->threads[i]->state != PARKED; i++)
+    ;
+  g->parked--;
+  return g->threads[i];
+}
+
+/**
+ * @brief Imprime el tiempo de respuesta de los grupos de hilos y la fragmentacion causada por gang scheduling
+ * @param table Tabla de procesos simulados
+ * @param ncpus Cantidad de procesadores
+ * @param config Parametros de la simulacion
+ * @param counters Contadores de la simulacion
+ */
+static void print_group_report(process_table *table, int ncpus, const sched_config *config, sched_counters *counters)
+{
+  process_group *g;
+  int arrival;
+  int finished;
+  int makespan;
+  int i;
+  int j;
+
+  if (table->ngroups == 0)
+  {
+    return;
+  }
+
+  printf("\nProcess groups\n");
+  printf("%-20s %8s %6s %5s %5s %11s %11s\n", "Group", "Threads", "Gang", "Arr.", "Fin.", "Turnaround", "Dispatches");
+  makespan = 0;
+  for (i = 0; i < table->count; i++)
+  {
+    makespan = max(makespan, table_process(table, i)->finished_time);
+  }
+  for (i = 0; i < table->ngroups; i++)
+  {
+    g = &table->groups[i];
+    // El grupo llega con su primer hilo y termina con su ultimo hilo
+    arrival = g->threads[0]->arrival_time;
+    finished = 0;
+    for (j = 0; j < g->size; j++)
+    {
+      arrival = min(arrival, g->threads[j]->arrival_time);
+      finished = max(finished, g->threads[j]->finished_time);
+    }
+    printf("%-20s %8d %6s %5d %5d %11d %11d\n", g->name, g->size,
+           !g->gang ? "no" : (gang_of(table, g->threads[0], ncpus, config) != NULL) ? "yes" : "off",
+           arrival, finished, finished - arrival, g->dispatches);
+  }
+  if (counters->gang_dispatches > 0 && makespan > 0)
+  {
+    printf("Gang scheduling: %d dispatches, %ld CPU time units idle while threads waited for their group (%.1f%% of the CPU time)\n",
+           counters->gang_dispatches, counters->gang_idle, 100.0 * counters->gang_idle / ((long)makespan * ncpus));
+  }
+}
+
+/**
+ * @brief Determina si la llegada de un proceso expropia al proceso en ejecucion
+ * @param config Parametros de la simulacion
+ * @param queues Arreglo de colas de prioridad
+ * @param running Proceso en ejecucion
+ * @param remaining Tiempo restante del proceso en ejecucion
+ * @param arrived Proceso que llega
+ * @return Regla que aplica (PREEMPT_PRIORITY, PREEMPT_SRT o PREEMPT_EDF), PREEMPT_NONE si no hay expropiacion
+ */
+static preemption_mode preemption_rule(const sched_config *config, priority_queue *queues,
+                                       process *running, int remaining, process *arrived)
+{
+  // Un proceso que termina en este instante no se expropia
+  if (remaining <= 0)
+  {
+    return PREEMPT_NONE;
+  }
+  if ((config->preemption & PREEMPT_PRIORITY) && arrived->priority < running->priority)
+  {
+    return PREEMPT_PRIORITY;
+  }
+  if (arrived->priority != running->priority)
+  {
+    return PREEMPT_NONE;
+  }
+  if ((config->preemption & PREEMPT_SRT) && queues[running->priority].strategy == SRT &&
+      arrived->remaining_time < remaining)
+  {
+    return PREEMPT_SRT;
+  }
+  if ((config->preemption & PREEMPT_EDF) && queues[running->priority].strategy == EDF &&
+      absolute_deadline(arrived) < absolute_deadline(running))
+  {
+    return PREEMPT_EDF;
+  }
+  return PREEMPT_NONE;
+}
+
+/* Ciclo generico: las operaciones se invocan a traves de la tabla de cada cola */
+#define SCHED_LOOP schedule_generic
+#define SCHED_READY(q) ((q)->ops->count(q))
+#define SCHED_SLICE(q, p) ((q)->ops->slice((q), (p)))
+#define SCHED_PICK(q) ((q)->ops->pick(q))
+#define SCHED_ON_TICK(q, p, used) ((q)->ops->on_tick((q), (p), (used)))
+#define SCHED_ON_PREEMPT(q, p) ((q)->ops->on_preempt((q), (p)))
+#include "schedloop.h"
+
+/* Ciclos especializados para configuraciones con una sola estrategia */
+#define SCHED_LOOP schedule_fifo
+#define SCHED_READY(q) list_count(q)
+#define SCHED_SLICE(q, p) unbounded_slice((q), (p))
+#define SCHED_PICK(q) ready_pick(q)
+#define SCHED_ON_TICK(q, p, used) never_expire((q), (p), (used))
+#define SCHED_ON_PREEMPT(q, p) fifo_enqueue((q), (p))
+#include "schedloop.h"
+
+#define SCHED_LOOP schedule_sjf
+#define SCHED_READY(q) list_count(q)
+#define SCHED_SLICE(q, p) unbounded_slice((q), (p))
+#define SCHED_PICK(q) ready_pick(q)
+#define SCHED_ON_TICK(q, p, used) never_expire((q), (p), (used))
+#define SCHED_ON_PREEMPT(q, p) sjf_enqueue((q), (p))
+#include "schedloop.h"
+
+#define SCHED_LOOP schedule_rr
+#define SCHED_READY(q) list_count(q)
+#define SCHED_SLICE(q, p) quantum_slice((q), (p))
+#define SCHED_PICK(q) ready_pick(q)
+#define SCHED_ON_TICK(q, p, used) quantum_expire((q), (p), (used))
+#define SCHED_ON_PREEMPT(q, p) fifo_enqueue((q), (p))
+#include "schedloop.h"
+
+#define SCHED_LOOP schedule_srt
+#define SCHED_READY(q) list_count(q)
+#define SCHED_SLICE(q, p) unbounded_slice((q), (p))
+#define SCHED_PICK(q) ready_pick(q)
+#define SCHED_ON_TICK(q, p, used) never_expire((q), (p), (used))
+#define SCHED_ON_PREEMPT(q, p) srt_enqueue((q), (p))
+#include "schedloop.h"
+
+/* Rutina para la planificacion.*/
+void schedule(process_table *table, priority_queue *queues, int nqueues, const sched_config *config)
+{
+  list *processes = table->processes;
+  int i;
+  list *sequence; // Secuencia de ejecucion
+  sequence_item * si; //Item de secuencia de CPU
+  int total_waiting; //Tiempo total de espera
+  node_iterator it; //Iterador de lista
+  process * p; //Apuntador a un proceso
+  const strategy_ops *ops; //Operaciones comunes a todas las colas
+  timing_wheel *wheel; //Eventos futuros
+  sched_counters counters; //Eventos y expropiaciones
+  io_device *devices; //Dispositivos de E/S
+  processor *cpus; //Procesadores de la topologia
+  int ncpus; //Cantidad de procesadores
+  time_series *series; //Metricas por ventana de tiempo
+  int tracing; //1 si se exporta la traza JSON
+
+  // Preparar para una nueva simulacion
+  STATS_BEGIN(STATS_PREPARE);
+  wheel = create_wheel(0);
+  prepare(processes, queues, nqueues, wheel, config);
+  sequence = create_list();
+  memset(&counters, 0, sizeof(sched_counters));
+  devices = create_devices(config->devices);
+  cpus = create_processors(config);
+  ncpus = config->sockets * config->cores;
+  compute_critical_path(table);
+  prepare_clients(table, config);
+  if (table->ncgroups > 0)
+  {
+    prepare_cgroups(table, queues, nqueues, wheel, config);
+  }
+  for (i = 0; i < table->ngroups; i++)
+  {
+    table->groups[i].parked = 0;
+    table->groups[i].finished = 0;
+    table->groups[i].dispatches = 0;
+    if (config->gang && table->groups[i].gang && table->groups[i].size > ncpus)
+    {
+      fprintf(stderr, "Group %s has %d threads but only %d CPUs, its threads run independently\n",
+              table->groups[i].name, table->groups[i].size, ncpus);
+    }
+  }
+
+  series = (config->window > 0) ? create_series(config->series, config->window, nqueues, ncpus) : NULL;
+  tracing = config->trace_events && open_trace_export(config->trace_file, table, nqueues, ncpus, config->trace_drop);
+  STATS_END(STATS_PREPARE);
+
+  // Usar un ciclo especializado si todas las colas usan la misma estrategia
+  STATS_BEGIN(STATS_SIMULATE);
+  ops = queues[0].ops;
+  for (i = 1; i < nqueues; i++)
+  {
+    if (queues[i].ops != ops)
+    {
+      ops = NULL;
+    }
+  }
+
+  if (ops == &fifo_ops)
+  {
+    schedule_fifo(table, queues, nqueues, sequence, wheel, devices, cpus, ncpus, config, &counters, series);
+  }
+  else if (ops == &sjf_ops)
+  {
+    schedule_sjf(table, queues, nqueues, sequence, wheel, devices, cpus, ncpus, config, &counters, series);
+  }
+  else if (ops == &rr_ops)
+  {
+    schedule_rr(table, queues, nqueues, sequence, wheel, devices, cpus, ncpus, config, &counters, series);
+  }
+  else if (ops == &srt_ops)
+  {
+    schedule_srt(table, queues, nqueues, sequence, wheel, devices, cpus, ncpus, config, &counters, series);
+  }
+  else
+  {
+    schedule_generic(table, queues, nqueues, sequence, wheel, devices, cpus, ncpus, config, &counters, series);
+  }
+
+  destroy_wheel(wheel);
+  if (series != NULL)
+  {
+    close_series(series);
+    printf("Time series saved to %s\n", config->series);
+  }
+  if (tracing)
+  {
+    close_trace_export();
+  }
+  STATS_ADD(events, counters.events);
+  STATS_END(STATS_SIMULATE);
+
+  // Los tiempos de espera se acumulan al asignar la CPU
+  STATS_BEGIN(STATS_REPORT);
+
+  // Imprimir resultados; con DEFINE quiet on solo los totales
+  if (!config->quiet)
+  {
+    for (i = 0; i < nqueues; i++)
+    {
+      print_queue(&queues[i]);
+    }
+    printf("%5s%20s%5s%5s%5s\n", "#", "Process", "Arr.", "Fin.", "Wait");
+  }
+  i = 1;
+  total_waiting = 0;
+  for (it = head(processes); it != 0; it = next(it))
+  {
+    p = (process *)it->data;
+    if (!config->quiet)
+    {
+      printf("%5d%20s%5d%5d%5d\n", i++, p->name, p->arrival_time, p->finished_time, p->waiting_time);
+    }
+    total_waiting = total_waiting + p->waiting_time;
+  }
+
+  printf("\nTotal waiting time: %d Average waiting time: %.3f\n", total_waiting, (float)((float)total_waiting / (int)processes->count));
+  printf("Simulated events: %ld\n", counters.events);
+  printf("Preemptions: %d (quantum: %d, priority: %d, srt: %d, edf: %d)\n",
+         counters.quantum + counters.priority + counters.srt + counters.edf,
+         counters.quantum, counters.priority, counters.srt, counters.edf);
+  if (config->mlfq || config->aging > 0 || config->boost > 0)
+  {
+    printf("Feedback: %d demotions, %d promotions, %d boosts\n", counters.demotions, counters.promotions, counters.boosts);
+  }
+  print_utilization(table, devices, config->devices, cpus, config, &counters);
+  print_group_report(table, ncpus, config, &counters);
+  print_cgroup_report(table);
+  print_dag_report(table, ncpus);
+  print_client_report(table);
+  destroy_devices(devices, config->devices);
+  free(cpus);
+  print_deadline_report(table);
+  print_share_report(table, queues, nqueues, config);
+  print_latency_report(queues, nqueues);
+
+  if (!config->quiet)
+  {
+    for (it = head(sequence); it != 0; it = next(it))
+    {
+      si = (sequence_item *)it->data;
+      printf("%s (%d) ", si->name, si->time);
+    }
+    printf("\n");
+  }
+  STATS_END(STATS_REPORT);
+}
+void init_config(sched_config *config)
+{
+  config->preemption = PREEMPT_NONE;
+  config->mlfq = 0;
+  config->aging = 0;
+  config->boost = 0;
+  config->seed = 1;
+  config->devices = 1;
+  config->switch_cost = 0;
+  config->reload_cost = 0;
+  config->reload_decay = RELOAD_DECAY;
+  config->sockets = 1;
+  config->cores = 1;
+  config->placement = PLACE_LOCAL;
+  config->migration_cost = 0;
+  config->gang = 1;
+  config->quiet = 0;
+  config->window = 0;
+  config->series = NULL;
+  config->trace_events = 0;
+  config->trace_drop = 0;
+  config->trace_file = NULL;
+}
+
+int reload_penalty(const sched_config *config, int gap)
+{
+  if (config->reload_cost <= 0 || gap == 0)
+  {
+    return 0;
+  }
+  if (gap < 0)
+  {
+    return config->reload_cost;
+  }
+  // La fraccion de la cache que se pierde crece exponencialmente con el tiempo fuera de la CPU
+  return (int)lround(config->reload_cost * (1.0 - exp(-(double)gap / config->reload_decay)));
+}
+
+priority_queue *create_queues(int n)
+{
+  priority_queue *ret;
+  int i;
+
+  ret = (priority_queue *)malloc(sizeof(priority_queue) * n);
+
+  for (i = 0; i < n; i++)
+  {
+    ret[i].strategy = RR; // Por defecto RR
+    ret[i].ops = get_strategy_ops(RR);
+    ret[i].quantum = 0;
+    ret[i].arrival = create_list();
+    ret[i].ready = create_list();
+    ret[i].finished = create_list();
+    ret[i].latency = CFS_LATENCY;
+    ret[i].granularity = CFS_GRANULARITY;
+    ret[i].tree = create_rbtree(compare_vruntime);
+    ret[i].load = 0;
+    ret[i].min_vruntime = 0;
+    ret[i].deadlines = create_heap(compare_deadline);
+    ret[i].critical = create_heap(compare_critical);
+    ret[i].lottery = 0;
+    ret[i].rng = 0;
+    ret[i].passes = create_heap(compare_pass);
+    ret[i].min_pass = 0;
+    ret[i].active_tickets = 0;
+    ret[i].ticket_clock = 0;
+    ret[i].members = 0;
+    ret[i].cgroups = 0;
+    ret[i].ncgroups = 0;
+    ret[i].runnable = 0;
+    ret[i].latencies = 0;
+  }
+
+  return ret;
+}
+
+void reset_queue(priority_queue *queue, int nprocesses, unsigned long long seed)
+{
+  // Operaciones de la estrategia definida para la cola
+  queue->ops = get_strategy_ops(queue->strategy);
+
+  // printf("Clearing queue %d\n", i);
+  if (queue->ready != 0)
+  {
+    clear_list(queue->ready, 0);
+    queue->ready = create_list();
+  }
+  if (queue->arrival != 0)
+  {
+    clear_list(queue->arrival, 0);
+    queue->arrival = create_list();
+  }
+  if (queue->finished != 0)
+  {
+    clear_list(queue->finished, 0);
+    queue->finished = create_list();
+  }
+  clear_rbtree(queue->tree, 0);
+  queue->load = 0;
+  queue->min_vruntime = 0;
+  clear_heap(queue->deadlines, 0);
+  clear_heap(queue->critical, 0);
+  clear_heap(queue->passes, 0);
+  queue->min_pass = 0;
+  queue->active_tickets = 0;
+  queue->ticket_clock = 0;
+  queue->cgroups = 0;
+  queue->runnable = 0;
+
+  // Los boletos se indexan por pid
+  destroy_fenwick(queue->lottery);
+  queue->lottery = (queue->strategy == LOTTERY) ? create_fenwick(nprocesses) : 0;
+  queue->rng = seed;
+}
+
+void print_queue(priority_queue *queue)
+{
+  //int i;
+  node_iterator ptr;
+
+  printf("%s q=", get_strategy_ops(queue->strategy)->name);
+  printf("%d ", queue->quantum);
+  if (queue->strategy == CFS)
+  {
+    printf("latency=%d granularity=%d ", queue->latency, queue->granularity);
+  }
+
+  printf("ready (%d): { ", get_strategy_ops(queue->strategy)->count(queue));
+
+  for (ptr = head(queue->ready); ptr != 0; ptr = next(ptr))
+  {
+    print_process((process *)ptr->data);
+  }
+
+  printf("} \n");
+
+  printf("arrival (%d): { ", queue->arrival->count);
+
+  for (ptr = head(queue->arrival); ptr != 0; ptr = next(ptr))
+  {
+    print_process((process *)ptr->data);
+  }
+
+  printf("} \n");
+
+  printf("finished (%d): { ", queue->finished->count);
+
+  for (ptr = head(queue->finished); ptr != 0; ptr = next(ptr))
+  {
+    print_process((process *)ptr->data);
+  }
+  printf("}\n");
+}
+
+int compare_arrival(void *const a, void *const b)
+{
+  process *p1;
+  process *p2;
+
+  p1 = (process *)a;
+  p2 = (process *)b;
+
+  // printf("Comparing %s to %s : %d %d\n", p1->name, p2->name, p1->arrival_time, p2->arrival_time);
+
+  return p2->arrival_time - p1->arrival_time;
+}
+
+int compare_sjf(void *const a, void *const b)
+{
+  process *p1;
+  process *p2;
+  int result;
+
+  p1 = (process *)a;
+  p2 = (process *)b;
+
+  // Si el otro proceso ya recibio la CPUel otro tiene prioridad
+  if (p2->cpu_time > 0)
+  {
+    result = -1;
+  }
+  else
+  {
+    result = p2->remaining_time - p1->remaining_time;
+  }
+
+  return result;
+}
+
+int compare_srt(void *const a, void *const b)
+{
+  process *p1;
+  process *p2;
+
+  int result;
+
+  p1 = (process *)a;
+  p2 = (process *)b;
+
+  // Si el otro proceso ya recibio la CPU y el nuevo no, el otro tiene prioridad
+  result = p2->remaining_time - p1->remaining_time;
+
+  return result;
+}
+
+int compare_vruntime(void *const a, void *const b)
+{
+  process *p1;
+  process *p2;
+
+  p1 = (process *)a;
+  p2 = (process *)b;
+
+  // El proceso con menor tiempo virtual va primero
+  return (p2->vruntime > p1->vruntime) - (p2->vruntime < p1->vruntime);
+}
+
+int compare_pass(void *const a, void *const b)
+{
+  process *p1;
+  process *p2;
+
+  p1 = (process *)a;
+  p2 = (process *)b;
+
+  // El menor valor de paso va primero; los empates se resuelven por orden de carga
+  if (p1->pass != p2->pass)
+  {
+    return (p1->pass < p2->pass) ? 1 : -1;
+  }
+  return p2->pid - p1->pid;
+}
+
+int absolute_deadline(process *p)
+{
+  return (p->deadline > 0) ? p->arrival_time + p->deadline : INT_MAX;
+}
+
+int compare_deadline(void *const a, void *const b)
+{
+  process *p1;
+  process *p2;
+  int d1;
+  int d2;
+
+  p1 = (process *)a;
+  p2 = (process *)b;
+
+  // El deadline mas cercano va primero; los empates se resuelven por orden de carga
+  d1 = absolute_deadline(p1);
+  d2 = absolute_deadline(p2);
+  if (d1 != d2)
+  {
+    return (d1 < d2) ? 1 : -1;
+  }
+  return p2->pid - p1->pid;
+}
+
+int compare_critical(void *const a, void *const b)
+{
+  process *p1;
+  process *p2;
+
+  p1 = (process *)a;
+  p2 = (process *)b;
+
+  if (p1->critical != p2->critical)
+  {
+    return (p1->critical > p2->critical) ? 1 : -1;
+  }
+  return p2->pid - p1->pid;
+}
+
+process_table *create_process_table()
+{
+  process_table *ret;
+
+  ret = (process_table *)malloc(sizeof(process_table));
+  ret->blocks = 0;
+  ret->nblocks = 0;
+  ret->count = 0;
+  ret->names = create_string_pool();
+  ret->processes = create_list();
+  ret->groups = 0;
+  ret->ngroups = 0;
+  ret->cgroups = 0;
+  ret->ncgroups = 0;
+  ret->pools = 0;
+  ret->npools = 0;
+
+  return ret;
+}
+
+process *create_process(process_table *table, char *name, int arrival_time, int execution_time)
+{
+
+  process *p;
+
+  // Reservar un nuevo bloque de procesos si el ultimo esta lleno
+  if (table->count == table->nblocks * PROCESS_BLOCK)
+  {
+    table->blocks = (process **)realloc(table->blocks, sizeof(process *) * (table->nblocks + 1));
+    table->blocks[table->nblocks++] = (process *)malloc(sizeof(process) * PROCESS_BLOCK);
+  }
+  p = table_process(table, table->count);
+  table->count++;
+
+  memset(p, 0, sizeof(process));
+  p->name = intern(table->names, name);
+  p->arrival_time = arrival_time;
+  p->execution_time = execution_time;
+  p->priority = -1;
+  p->waiting_time = -1;
+  p->remaining_time = p->execution_time;
+  p->finished_time = -1;
+  p->cpu_time = 0;
+  p->weight = NICE_0_WEIGHT;
+  p->tickets = DEFAULT_TICKETS;
+  p->node = -1;
+  p->group = -1;
+  p->cgroup = 0;
+  p->state = LOADED;
+  p->slices = create_list();
+
+  return p;
+}
+
+int create_group(process_table *table, char *name, int size, int gang)
+{
+  process_group *g;
+
+  table->groups = (process_group *)realloc(table->groups, sizeof(process_group) * (table->ngroups + 1));
+  g = &table->groups[table->ngroups];
+  memset(g, 0, sizeof(process_group));
+  g->name = intern(table->names, name);
+  g->gang = gang;
+  g->size = size;
+  g->threads = (process **)malloc(sizeof(process *) * size);
+
+  return table->ngroups++;
+}
+
+void restart_process(process *p)
+{
+
+  p->waiting_time = -1;
+  p->finished_time = -1;
+  p->remaining_time = p->execution_time;
+  p->burst = 0;
+  p->burst_left = (p->bursts != NULL) ? p->bursts[0] : p->execution_time;
+  p->blocked_since = 0;
+  p->last_run = -1;
+  p->first_run = -1;
+  p->home = p->node;
+  p->cpu = -1;
+  p->migrations = 0;
+  p->remote_time = 0;
+  p->reserved = 0;
+  p->throttled_time = 0;
+  p->pending = p->npredecessors;
+  p->released = (p->npredecessors == 0) ? p->arrival_time : -1;
+  p->cpu_time = 0;
+  p->ready_since = p->arrival_time;
+  p->priority = p->base_priority;
+  p->aging_timer = NULL;
+  p->vruntime = 0;
+  p->pass = 0;
+  p->ticket_clock = 0;
+  p->entitled = 0;
+  p->state = LOADED;
+  clear_list(p->slices, 1);
+}
+
+/**
+ * @brief Obtiene el nombre de un tipo de slice
+ * @param type Tipo de slice
+ * @return Nombre del tipo
+ */
+static const char *slice_name(slice_type type)
+{
+  switch (type)
+  {
+  case CPU:
+    return "CPU";
+  case IO:
+    return "IO";
+  case SWITCH:
+    return "SWITCH";
+  case RELOAD:
+    return "RELOAD";
+  case MIGRATE:
+    return "MIGRATE";
+  case THROTTLED:
+    return "THROTTLED";
+  case WAIT:
+  default:
+    return "WAIT";
+  }
+}
+
+void print_slices(process *p)
+{
+  node_iterator it;
+  slice *s;
+
+  for (it = head(p->slices); it != 0; it = next(it))
+  {
+    s = it->data;
+    printf("%s %d -> %d ", slice_name(s->type), s->from, s->to);
+  }
+}
+
+void print_process(process *p)
+{
+  if (p == 0)
+  {
+    return;
+  }
+  printf("(%s arrival:%d execution:%d finished:%d waiting:%d ",
+         p->name, p->arrival_time, p->execution_time, p->finished_time, p->waiting_time);
+  // UNDEFINED, LOADED, READY, RUNNING, FINISHED
+  printf("%s )\n", (p->state == READY) ? "ready" : (p->state == LOADED) ? "loaded"
+                                               : (p->state == FINISHED) ? "finished"
+                                                                        : "unknown");
+}
+
+void prepare(list *processes, priority_queue *queues, int nqueues, timing_wheel *wheel, const sched_config *config)
+{
+  int i;
+  process *p;
+  node_iterator it;
+
+  /* Limpiar las colas de prioridad */
+
+  for (i = 0; i < nqueues; i++)
+  {
+    // Cada cola LOTTERY tiene su propio generador
+    reset_queue(&queues[i], processes->count, config->seed + i);
+    if (queues[i].latencies == 0)
+    {
+      queues[i].latencies = create_latencies();
+    }
+    reset_latencies(queues[i].latencies);
+  }
+
+  /* Inicializar la informacion de los procesos y programar sus llegadas */
+  for (it = head(processes); it != 0; it = next(it))
+  {
+    p = (process *)it->data;
+    restart_process(p);
+    // Un proceso con predecesores llega cuando el ultimo de ellos termina
+    if (p->pending == 0)
+    {
+      wheel_schedule(wheel, p->arrival_time, EV_ARRIVAL, p);
+    }
+  }
+
+  if (config->quiet)
+  {
+    return;
+  }
+  printf("Prepared queues:\n");
+  for (i=0; i<nqueues; i++) {
+    print_queue(&queues[i]);
+  }
+}
+
+int process_arrival(int now, priority_queue *queues, int nqueues, timing_wheel *wheel, const sched_config *config)
+{
+  int i;
+  process *p;
+  //process *aux;
+  int queue_processed;
+  int total;
+  int since;
+
+  // Procesar llegadas.
+  total = 0;
+  for (i = 0; i < nqueues; i++)
+  {
+
+    // printf("Queue %d\n", i);
+    if (empty(queues[i].arrival))
+    {
+      // Pasar a la siguiente cola.
+      continue;
+    }
+
+    queue_processed = 0;
+    do
+    {
+      // Procesar las llegadas de nuevos procesos
+      p = front(queues[i].arrival);
+
+      if (p == 0)
+      {
+        queue_processed = 1;
+        continue;
+      }
+
+      // Ignorar el proceso si no es momento de llevarlo a la cola de listos
+      if (p->arrival_time > now)
+      {
+        queue_processed = 1;
+        continue;
+      }
+
+      if (p->burst == 0)
+      {
+        // ready_since es la llegada, o el fin del ultimo predecesor si es posterior
+        trace(config, "[%d] Process %s arrived at %d.\n", now, p->name, p->ready_since);
+        p->waiting_time = now - p->ready_since;
+        since = p->ready_since;
+      }
+      else
+      {
+        // El proceso vuelve de una rafaga de E/S
+        trace(config, "[%d] Process %s returned from I/O at %d.\n", now, p->name, p->ready_since);
+        p->waiting_time += now - p->ready_since;
+        since = p->ready_since;
+      }
+
+      // Los boletos del proceso compiten desde su admision
+      queues[p->base_priority].active_tickets += p->tickets;
+      p->ticket_clock = queues[p->base_priority].ticket_clock;
+
+      // Dibujar la linea del tiempo de espera
+      if (now > since)
+      {
+        add_slice(p, WAIT, since, now);
+      }
+
+      total++;
+
+      // Cada estrategia decide donde se inserta el nuevo proceso
+      queues[i].ops->enqueue(&queues[i], p);
+      STATS_COUNT(inserts);
+      make_ready(p, now, wheel, config);
+
+      // Quitar el proceso de la cola de llegadas
+      pop_front(queues[i].arrival);
+
+    } while (!queue_processed);
+  }
+  // Retorna el numero de procesos que se pasaron a las colas de listos
+  return total;
+}
+
+int get_next_arrival(priority_queue *queues, int nqueues)
+{
+  int ret;
+  process *p;
+  int i;
+  int arrival_time;
+  //int min_time;
+
+  ret = INT_MAX;
+  arrival_time = ret;
+
+  for (i = 0; i < nqueues; i++)
+  {
+    // Revisar el primer proceso en la cola de listos
+    p = front(queues[i].arrival);
+    if (p != 0)
+    {
+      arrival_time = p->arrival_time;
+      ret = min(ret, arrival_time);
+    }
+  }
+
+  // printf("Next arrival : %d\n", ret);
+
+  if (ret == INT_MAX)
+  {
+    ret = -1;
+  }
+
+  return ret;
+}
+
+int get_ready_count(priority_queue *queues, int nqueues)
+{
+  int ret;
+  int i;
+
+  ret = 0;
+
+  for (i = 0; i < nqueues; i++)
+  {
+    ret = ret + queues[i].ops->count(&queues[i]);
+  }
+  return ret;
+}
+
+int max_scheduling_time(process_table *table)
+{
+  //int process_total;
+  int i;
+  process *p;
+  int max;
+
+  max = 0;
+
+  // Calcular el tiempo como la suma de los tiempos de ejecucion de los procesos.
+  for (i = 0; i < table->count; i++)
+  {
+    p = table_process(table, i);
+    // Sumar el tiempo total de CPU y lock
+    if (p->finished_time > max)
+    {
+      max = p->finished_time;
+    }
+  }
+
+  return max;
+}
+
+slice *create_slice(slice_type type, int from, int to)
+{
+  slice *s;
+
+  s = (slice *)malloc(sizeof(slice));
+  s->type = type;
+  s->from = from;
+  s->to = to;
+  return s;
+}
+
+void add_slice(process *p, slice_type type, int from, int to)
+{
+  slice *s;
+
+  export_slice(p, type, from, to);
+  s = (slice *)back(p->slices);
+  if (s != 0 && s->type == type && s->to == from)
+  {
+    s->to = to;
+    return;
+  }
+  push_back(p->slices, create_slice(type, from, to));
+}
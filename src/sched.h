@@ -1,198 +1,594 @@
-#ifndef SCHED_H
-#define SCHED_H
-
-/**
- * @file
- * @brief Planificacion de procesos.
- * @author Erwin Meza Vega <emezav@unicauca.edu.co>
- * @copyright MIT License
- */
-
-#include "list.h"
-
-#ifndef min
-/** @brief Encuentra el minimo entre dos valores */
-#define min(a, b) (((a) < (b)) ? (a) : (b))
-#endif
-
-/** @brief Algoritmo de planificacion */
-typedef enum
-{
-  FIFO,
-  SJF,
-  RR,
-  SRT
-} strategy;
-
-/** @brief Tipo de slice de tiempo */
-typedef enum
-{
-  CPU,
-  WAIT
-} slice_type;
-
-/** @brief Tajada de tiempo*/
-typedef struct
-{
-  slice_type type; /*!< Tipo de slice */
-  int from;        /*!< Tiempo inicial */
-  int to;          /*!< Tiempo final */
-} slice;
-
-/** @brief Estados de un proceso */
-enum state
-{
-  UNDEFINED,
-  LOADED,
-  READY,
-  RUNNING,
-  FINISHED
-};
-
-/** @brief Item de secuencia de ejecucion de un proceso */
-typedef struct
-{
-  char *name; /*!< Proceso de la secuencia (cpu)*/
-  int time;   /*!< Tiempo de la secuencia */
-} sequence_item;
-
-/** @brief Definicion de un proceso */
-typedef struct
-{
-  int pid;            /*!< PID Del proceso */
-  char name[80];      /*!< Nombre del proceso (archivo ejecutable) */
-  int priority;       /*!< Prioridad */
-  int arrival_time;   /*!< Tiempo de llegada */
-  int execution_time; /*!< Tiempo total de ejecucion */
-  int remaining_time; /*!< Tiempo restante de ejecucion */
-  int waiting_time;   /*!< Tiempo de espera */
-  int finished_time;  /*!< Tiempo de finalizacion */
-  int cpu_time;       /*!< Tiempo de CPU que ha sido asignado */
-  enum state state;   /*!< Estado del proceso */
-  list *slices;       /*!< Slices de tiempo */
-} process;
-
-/** @brief Cola de prioridad */
-typedef struct
-{
-  int quantum;       /*!< Quantum asignado a la cola de prioridad */
-  strategy strategy; /*!< Estrategia de planificacion */
-  list *ready;       /*!< Cola de procesos listos */
-  list *arrival;     /*!< Cola de llegada de procesos*/
-  list *finished;    /*!< Cola de procesos finalizados */
-} priority_queue;
-
-/**
- * @brief Rutina para la planificacion
- * @param processes Lista de procesos.
- * @param queues Arreglo de colas de prioridad.
- * @param nqueues Cantidad de colas de prioridad.
- */
-void schedule(list *processes, priority_queue *queues, int nqueues);
-
-/**
- * @brief Crea un arreglo de colas de prioridad
- * @param n Numero de colas de prioridad
- * @return Arreglo de colas de prioridad
- */
-priority_queue *create_queues(int n);
-
-/**
- * @brief Imprime la informacion de una cola de prioridad
- * @param queue Cola de prioridad a imprimir
- */
-void print_queue(priority_queue *queue);
-
-/**
- * @brief Retorna el numero de procesos listos en una cola de prioridad
- * @param queues Colas de prioridad
- * @param nqueues Numero de colas de prioridad
- * @return Cantidad de procesos en estado de listo en todas las colas.
- */
-int get_ready_count(priority_queue *queues, int nqueues);
-
-/**
- * @brief Retorna el tiempo en el cual se presenta la nueva llegada a la cola de listos de una cola de prioridad
- * @param queues Arreglo de colas de prioridad
- * @param nqueues Cantidad de colas de prioridad
- * @return Tiempo de llegada del nuevo proceso
- */
-int get_next_arrival(priority_queue *queues, int nqueues);
-
-/**
- * @brief Procesa la llegada de procesos  a una cola de prioridad
- * @param now Tiempo actual
- * @param queues Arreglo de colas de prioridad
- * @param nqueues Cantidad de colas de prioridad
- * @return Cantidad de procesos que se pasaron a estado de listo
- */
-int process_arrival(int now, priority_queue *queues, int nqueues);
-
-/**
- * @brief  Imprimir la informacion de un proceso
- * @param p Proceso a imprimir
- */
-void print_process(process *p);
-
-/**
- * @brief Crea un nuevo proceso.
- * @param name Nombre del proceso
- * @param arrival_time Tiempo de llegada
- * @param execution_time Tiempo de ejecucion
- * @return Nuevo proceso
- */
-process *create_process(char *name, int arrival_time, int execution_time);
-
-/**
- * @brief Reinicia un un proceso
- * @param p Proceso
- */
-void restart_process(process *p);
-
-/**
- * @brief Compara dos procesos por tiempo de llegada.
- * @param a Proceso A
- * @param b Proceso B
- * @return Resta de los tiempos de llegada de p2 y p1
- */
-int compare_arrival(void *const a, void *const b);
-
-/**
- * @brief Compara dos procesos siguiendo el criterio de SJF.
- * @param a Proceso A
- * @param b Proceso B
- * @return Resta de los tiempos de llegada de p2 y p1
- */
-int compare_sjf(void *const a, void *const b);
-
-/**
- * @brief Compara dos procesos siguiendo el criterio de SRT.
- * @param a Proceso A
- * @param b Proceso B
- * @return Resta de los tiempos de llegada de p2 y p1
- */
-int compare_srt(void *const a, void *const b);
-
-/**
- * @brief Prepara las estructuras de datos para la simulacion.
- * @param processes Lista de procesos.
- * @param queues Arreglo de colas de prioridad.
- * @param nqueues Cantidad de colas de prioridad.
- */
-void prepare(list *processes, priority_queue *queues, int nqueues);
-
-/**
- * @brief  Calcula el tiempo total de la simulacion
- * @param processes Lista de procesos
- * @return Tiempo en el cual termina el ultimo proceso
- */
-int max_scheduling_time(list *processes);
-
-/**
- * @brief Calcula el tiempo total de un proceso
- * @param p Proceso a calcular el tiempo total
- * @return Tiempo total de un proceso
- */
-int process_scheduling_time(process *p);
-
+#ifndef SCHED_H
+#define SCHED_H
+
+/**
+ * @file
+ * @brief Planificacion de procesos.
+ * @author Erwin Meza Vega <emezav@unicauca.edu.co>
+ * @copyright MIT License
+ */
+
+#include "fenwick.h"
+#include "heap.h"
+#include "list.h"
+#include "rbtree.h"
+#include "strpool.h"
+#include "twheel.h"
+
+#ifndef min
+/** @brief Encuentra el minimo entre dos valores */
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef max
+/** @brief Encuentra el maximo entre dos valores */
+#define max(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/** @brief Imprime el mensaje de un evento de la simulacion, salvo con DEFINE quiet on */
+#define trace(config, ...)      \
+  do                            \
+  {                             \
+    if (!(config)->quiet)       \
+    {                           \
+      printf(__VA_ARGS__);      \
+    }                           \
+  } while (0)
+
+/** @brief Algoritmo de planificacion */
+typedef enum
+{
+  FIFO,
+  SJF,
+  RR,
+  SRT,
+  CFS,
+  EDF,
+  LOTTERY,
+  STRIDE,
+  CP
+} strategy;
+
+/** @brief Boletos por defecto de un proceso (LOTTERY, STRIDE) */
+#define DEFAULT_TICKETS 100
+
+/** @brief Numerador del paso de un proceso: paso = STRIDE1 / boletos (STRIDE) */
+#define STRIDE1 (1 << 20)
+
+/** @brief Peso de un proceso con nice 0 (CFS) */
+#define NICE_0_WEIGHT 1024
+
+/** @brief Fraccion del tiempo virtual: unidades de vruntime por unidad de tiempo con nice 0 (CFS) */
+#define VRUNTIME_SCALE 1024
+
+/** @brief Latencia objetivo por defecto de una cola CFS */
+#define CFS_LATENCY 12
+
+/** @brief Granularidad minima por defecto de una cola CFS */
+#define CFS_GRANULARITY 2
+
+/** @brief Modo de simulacion */
+typedef enum
+{
+  EXACT,  /*!< Simulacion exacta, unidad por unidad de tiempo */
+  FLUID,  /*!< Aproximacion de procesador compartido en las colas RR */
+  COMPARE, /*!< Aproximacion y simulacion exacta, reportando el error */
+  SWEEP    /*!< Simulacion por lotes de varios valores de quantum */
+} sim_mode;
+
+/** @brief Reglas de expropiacion ante la llegada de un proceso, combinables con | */
+typedef enum
+{
+  PREEMPT_NONE = 0,     /*!< Las llegadas se admiten solo cuando la CPU queda libre */
+  PREEMPT_PRIORITY = 1, /*!< Una llegada a una cola de mayor prioridad expropia */
+  PREEMPT_SRT = 2,      /*!< En una cola SRT, una llegada con menor tiempo restante expropia */
+  PREEMPT_EDF = 4,      /*!< En una cola EDF, una llegada con deadline mas cercano expropia */
+  PREEMPT_ALL = 7       /*!< Todas las reglas */
+} preemption_mode;
+
+/** @brief Cantidad maxima de sockets de la topologia */
+#define MAX_SOCKETS 64
+
+/** @brief Politicas de ubicacion de un proceso en un procesador libre */
+typedef enum
+{
+  PLACE_LOCAL,  /*!< Preferir el socket de afinidad del proceso */
+  PLACE_SPREAD, /*!< Preferir el socket con menos procesadores ocupados */
+  PLACE_PACK    /*!< Preferir el socket con mas procesadores ocupados */
+} placement_policy;
+
+/** @brief Parametros de la simulacion exacta */
+typedef struct
+{
+  int preemption;             /*!< Reglas de expropiacion ante llegadas (preemption_mode) */
+  int mlfq;                   /*!< 1 si un proceso que agota su quantum baja a la siguiente cola */
+  int aging;                  /*!< Espera tras la cual un proceso listo sube una cola, 0 = sin envejecimiento */
+  int boost;                  /*!< Periodo para subir todos los procesos a la primera cola, 0 = sin impulso */
+  unsigned long long seed;    /*!< Semilla de los sorteos (LOTTERY) y de los tiempos de reflexion (CLIENT) */
+  int devices;                /*!< Cantidad de dispositivos de E/S */
+  int switch_cost;            /*!< Duracion de un cambio de contexto */
+  int reload_cost;            /*!< Penalizacion maxima por recargar la cache (cache fria) */
+  int reload_decay;           /*!< Tiempo fuera de la CPU en el que la cache se enfria un 63% */
+  int sockets;                /*!< Sockets de la topologia */
+  int cores;                  /*!< Procesadores por socket */
+  int placement;              /*!< Politica de ubicacion (placement_policy) */
+  int migration_cost;         /*!< Penalizacion por ejecutar en un socket distinto al anterior */
+  int gang;                   /*!< 1 si los hilos de los grupos gang=N ejecutan simultaneamente */
+  int quiet;                  /*!< 1 si solo se imprime el resumen, sin eventos, listados por proceso ni grafica */
+  int window;                 /*!< Ancho de las ventanas de la serie de tiempo, 0 = sin serie */
+  const char *series;         /*!< Archivo CSV de la serie de tiempo (ver timeseries.h) */
+  int trace_events;           /*!< 1 si se exporta la simulacion en formato Trace Event JSON */
+  int trace_drop;             /*!< 1 si la traza descarta eventos cuando su escritor se atrasa, 0 si la simulacion espera */
+  const char *trace_file;     /*!< Archivo JSON de la traza (ver traceexport.h) */
+} sched_config;
+
+/** @brief Tiempo por defecto en el que se enfria la cache de un proceso */
+#define RELOAD_DECAY 10
+
+/** @brief Cantidad maxima de dispositivos de E/S */
+#define MAX_DEVICES 16
+
+/** @brief Contadores de la simulacion exacta */
+typedef struct
+{
+  long events;       /*!< Eventos procesados */
+  int quantum;       /*!< Expropiaciones por fin de quantum */
+  int priority;      /*!< Expropiaciones por llegada a una cola de mayor prioridad */
+  int srt;           /*!< Expropiaciones por llegada de un proceso mas corto (SRT) */
+  int edf;           /*!< Expropiaciones por llegada de un deadline mas cercano (EDF) */
+  int demotions;     /*!< Procesos que bajaron de cola al agotar su quantum */
+  int promotions;    /*!< Procesos que subieron de cola por envejecimiento */
+  int boosts;        /*!< Impulsos periodicos a la primera cola */
+  int switches;      /*!< Cambios de contexto */
+  long switch_time;  /*!< Tiempo de CPU perdido en cambios de contexto */
+  long reload_time;  /*!< Tiempo de CPU perdido recargando la cache */
+  int migrations;    /*!< Cambios de socket de los procesos */
+  long migration_time; /*!< Tiempo de CPU perdido por migraciones */
+  int gang_dispatches; /*!< Asignaciones simultaneas de todos los hilos de un grupo */
+  long gang_idle;    /*!< Tiempo de CPU libre mientras hay hilos esperando a su grupo */
+} sched_counters;
+
+/** @brief Tipo de slice de tiempo */
+typedef enum
+{
+  CPU,
+  WAIT,
+  IO,
+  SWITCH,
+  RELOAD,
+  MIGRATE,
+  THROTTLED
+} slice_type;
+
+/** @brief Tajada de tiempo*/
+typedef struct
+{
+  slice_type type; /*!< Tipo de slice */
+  int from;        /*!< Tiempo inicial */
+  int to;          /*!< Tiempo final */
+} slice;
+
+/** @brief Tipos de evento de la simulacion */
+typedef enum
+{
+  EV_ARRIVAL,    /*!< Llegada de un proceso */
+  EV_COMPLETION, /*!< Fin de la rafaga de CPU del proceso en ejecucion */
+  EV_QUANTUM,    /*!< Fin del quantum del proceso en ejecucion */
+  EV_AGING,      /*!< Un proceso listo cumple el umbral de envejecimiento */
+  EV_BOOST,      /*!< Impulso periodico a la primera cola */
+  EV_IO,         /*!< Fin de la rafaga de E/S de un proceso bloqueado */
+  EV_PERIOD      /*!< Inicio del periodo de la cuota de uno o mas grupos de control */
+} event_type;
+
+/** @brief Estados de un proceso */
+enum state
+{
+  UNDEFINED,
+  LOADED,
+  READY,
+  RUNNING,
+  BLOCKED,
+  PARKED,
+  FINISHED
+};
+
+/** @brief Item de secuencia de ejecucion de un proceso */
+typedef struct
+{
+  const char *name; /*!< Proceso de la secuencia (cpu)*/
+  int time;   /*!< Tiempo de la secuencia */
+} sequence_item;
+
+/**
+ * @brief Definicion de un proceso
+ * @note Los campos que se recorren en cada unidad de tiempo van primero, y el
+ * nombre se guarda internado, para mantener el registro compacto.
+ */
+typedef struct process
+{
+  enum state state;   /*!< Estado del proceso */
+  int priority;       /*!< Prioridad (cola actual) */
+  int arrival_time;   /*!< Tiempo de llegada */
+  int execution_time; /*!< Tiempo total de ejecucion (suma de las rafagas de CPU) */
+  int remaining_time; /*!< Tiempo restante de ejecucion */
+  int burst_left;     /*!< Tiempo restante de la rafaga de CPU actual */
+  int waiting_time;   /*!< Tiempo de espera */
+  int finished_time;  /*!< Tiempo de finalizacion */
+  int cpu_time;       /*!< Tiempo de CPU que ha sido asignado */
+  int ready_since;    /*!< Tiempo desde el cual el proceso espera en la cola de listos */
+  int base_priority;  /*!< Prioridad definida en la configuracion */
+  event *aging_timer; /*!< Evento de envejecimiento pendiente */
+  int weight;         /*!< Peso derivado del valor nice (CFS) */
+  long long vruntime; /*!< Tiempo de ejecucion virtual, en 1/VRUNTIME_SCALE unidades (CFS) */
+  int deadline;       /*!< Deadline relativo a la llegada, 0 = sin deadline */
+  int tickets;        /*!< Boletos que definen la proporcion de CPU solicitada (LOTTERY, STRIDE) */
+  long long pass;     /*!< Valor de paso acumulado (STRIDE) */
+  double ticket_clock; /*!< Reloj de boletos de la cola al ser admitido */
+  double entitled;    /*!< Tiempo de CPU que corresponde a sus boletos, acumulado al bloquearse o terminar */
+  int *bursts;        /*!< Rafagas alternas de CPU y E/S, NULL si solo tiene una rafaga de CPU */
+  int nbursts;        /*!< Cantidad de rafagas (impar: comienza y termina con CPU) */
+  int burst;          /*!< Indice de la rafaga actual */
+  int device;         /*!< Dispositivo que atiende sus rafagas de E/S */
+  int blocked_since;  /*!< Tiempo en el que se bloqueo por E/S */
+  int last_run;       /*!< Tiempo en el que dejo la CPU por ultima vez, -1 si no ha ejecutado */
+  int first_run;      /*!< Tiempo de la primera asignacion de la CPU, -1 si no ha ejecutado */
+  int node;           /*!< Socket de afinidad definido en la configuracion, -1 si no tiene */
+  int home;           /*!< Socket de afinidad en la simulacion: node, o el primero en el que ejecuta */
+  int cpu;            /*!< Procesador actual o el ultimo en el que ejecuto, -1 si ninguno */
+  int migrations;     /*!< Cambios de socket */
+  int remote_time;    /*!< Tiempo de CPU fuera del socket de afinidad */
+  int group;          /*!< Grupo de hilos al que pertenece, -1 si no pertenece a un grupo */
+  int cgroup;         /*!< Grupo de control al que pertenece, 0 = raiz */
+  int reserved;       /*!< CPU reservada de la cuota de sus grupos de control en la asignacion actual */
+  int throttled_time; /*!< Tiempo listo mientras su grupo de control agoto su cuota */
+  int npredecessors;  /*!< Procesos que deben terminar antes de que el proceso llegue */
+  int pending;        /*!< Predecesores sin terminar (grado de entrada restante) */
+  struct process **successors; /*!< Procesos que dependen de este proceso */
+  int nsuccessors;    /*!< Cantidad de sucesores */
+  int released;       /*!< Tiempo en el que terminaron sus predecesores, -1 si no han terminado */
+  int think;          /*!< Tiempo de reflexion entre el fin de sus predecesores y su llegada (clientes) */
+  long critical;      /*!< CPU del proceso y de su cadena de sucesores mas larga (CP) */
+  int pid;            /*!< PID Del proceso */
+  const char *name;   /*!< Nombre del proceso (archivo ejecutable), internado */
+  list *slices;       /*!< Slices de tiempo */
+} process;
+
+/**
+ * @brief Grupo de hilos de un PROCESS con threads=N o gang=N.
+ * Cada hilo es un proceso de la tabla con las mismas rafagas y atributos.
+ */
+typedef struct
+{
+  const char *name;   /*!< Nombre del grupo, internado */
+  int gang;           /*!< 1 si sus hilos deben ejecutar simultaneamente (gang=N) */
+  int size;           /*!< Cantidad de hilos */
+  process **threads;  /*!< Hilos del grupo */
+  int parked;         /*!< Hilos retirados de su cola que esperan a los demas hilos (PARKED) */
+  int finished;       /*!< Hilos terminados */
+  int dispatches;     /*!< Asignaciones simultaneas de todos sus hilos */
+} process_group;
+
+/**
+ * @brief Clientes de ciclo cerrado de una linea CLIENT.
+ * Cada cliente es una cadena de trabajos: el trabajo k+1 llega un tiempo de
+ * reflexion despues de que termina el trabajo k.
+ */
+typedef struct
+{
+  const char *name;   /*!< Nombre de los clientes, internado */
+  int clients;        /*!< Cantidad de clientes */
+  int jobs;           /*!< Trabajos de cada cliente */
+  int think;          /*!< Tiempo medio de reflexion */
+  int first;          /*!< Indice en la tabla del primer trabajo del primer cliente */
+} client_pool;
+
+/** @brief Cantidad maxima de grupos de control, incluyendo la raiz */
+#define MAX_CGROUPS 32
+
+/** @brief Peso por defecto de un grupo de control, y de los procesos propios de un grupo frente a sus hijos */
+#define CGROUP_WEIGHT 100
+
+/**
+ * @brief Grupo de control: reparte la CPU entre sus hijos de acuerdo con su peso
+ * y limita la CPU de sus procesos a una cuota por periodo.
+ */
+typedef struct
+{
+  const char *name;        /*!< Ruta del grupo (ej. web/api), internada; "/" para la raiz */
+  int parent;              /*!< Indice del grupo padre, -1 para la raiz */
+  int weight;              /*!< Peso frente a sus hermanos */
+  int quota;               /*!< CPU por periodo, 0 = sin limite */
+  int period;              /*!< Duracion del periodo de la cuota */
+  long long vruntime;      /*!< Tiempo virtual del grupo frente a sus hermanos */
+  long long self_vruntime; /*!< Tiempo virtual de sus propios procesos frente a sus hijos */
+  long long min_vruntime;  /*!< Mayor tiempo virtual elegido entre sus hijos, no decreciente */
+  long consumed;           /*!< CPU consumida en el periodo actual */
+  long reserved;           /*!< CPU reservada por sus procesos en ejecucion */
+  int throttled;           /*!< 1 si agoto su cuota en el periodo actual */
+  int throttled_at;        /*!< Tiempo en el que agoto su cuota */
+  int depth;               /*!< Grupos agotados en la ruta hasta la raiz, incluyendo este */
+  int blocked_since;       /*!< Tiempo desde el cual depth > 0 */
+  list *throttles;         /*!< Intervalos en los que depth > 0, como slices THROTTLED */
+  long usage;              /*!< CPU recibida por el grupo y sus descendientes */
+  int nr_throttled;        /*!< Periodos en los que agoto su cuota */
+  long throttled_total;    /*!< Tiempo total con la cuota agotada */
+} control_group;
+
+/** @brief Cantidad de procesos por bloque de la tabla de procesos */
+#define PROCESS_BLOCK 1024
+
+/**
+ * @brief Tabla de procesos.
+ * Los procesos se almacenan en bloques contiguos, de modo que los recorridos
+ * completos de la tabla no siguen apuntadores de lista.
+ */
+typedef struct
+{
+  process **blocks;   /*!< Bloques de PROCESS_BLOCK procesos */
+  int nblocks;        /*!< Cantidad de bloques */
+  int count;          /*!< Cantidad de procesos */
+  string_pool *names; /*!< Nombres de los procesos */
+  list *processes;    /*!< Procesos ordenados por nombre */
+  process_group *groups; /*!< Grupos de hilos */
+  int ngroups;        /*!< Cantidad de grupos de hilos */
+  control_group *cgroups; /*!< Grupos de control (MAX_CGROUPS), NULL si no se han definido */
+  int ncgroups;       /*!< Cantidad de grupos de control, incluyendo la raiz */
+  client_pool *pools; /*!< Clientes de ciclo cerrado */
+  int npools;         /*!< Cantidad de lineas CLIENT */
+} process_table;
+
+/** @brief Obtiene el i-esimo proceso de una tabla */
+#define table_process(t, i) (&(t)->blocks[(i) / PROCESS_BLOCK][(i) % PROCESS_BLOCK])
+/** @brief Dispositivo de E/S: atiende las rafagas de E/S en orden de llegada */
+typedef struct
+{
+  list *queue;       /*!< Procesos bloqueados que esperan el dispositivo */
+  process *current;  /*!< Proceso atendido, NULL si el dispositivo esta libre */
+  long busy_time;    /*!< Tiempo total de servicio */
+  long queued_time;  /*!< Tiempo total de espera en la cola del dispositivo */
+  int requests;      /*!< Rafagas de E/S atendidas */
+} io_device;
+
+struct strategy_ops;
+struct latency_histograms;
+
+/** @brief Cola de prioridad */
+typedef struct priority_queue
+{
+  int quantum;                    /*!< Quantum asignado a la cola de prioridad */
+  strategy strategy;              /*!< Estrategia de planificacion */
+  const struct strategy_ops *ops; /*!< Operaciones de la estrategia (ver policy.h) */
+  list *ready;       /*!< Cola de procesos listos */
+  list *arrival;     /*!< Cola de llegada de procesos*/
+  list *finished;    /*!< Cola de procesos finalizados */
+  int latency;       /*!< Latencia objetivo (CFS) */
+  int granularity;   /*!< Tiempo minimo de ejecucion (CFS) */
+  rbtree *tree;      /*!< Procesos listos ordenados por vruntime (CFS) */
+  long load;         /*!< Suma de los pesos de los procesos listos (CFS) */
+  long long min_vruntime; /*!< Menor vruntime de la cola, no decreciente (CFS) */
+  heap *deadlines;   /*!< Procesos listos ordenados por deadline (EDF) */
+  heap *critical;    /*!< Procesos listos ordenados por camino critico (CP) */
+  fenwick *lottery;  /*!< Boletos de los procesos listos, por pid (LOTTERY) */
+  unsigned long long rng; /*!< Estado del generador de sorteos (LOTTERY) */
+  heap *passes;      /*!< Procesos listos ordenados por valor de paso (STRIDE) */
+  long long min_pass; /*!< Menor valor de paso de la cola, no decreciente (STRIDE) */
+  long active_tickets; /*!< Boletos de los procesos admitidos y no terminados */
+  double ticket_clock; /*!< CPU recibida por la cola dividida entre los boletos activos, acumulada */
+  struct priority_queue *members; /*!< Cola de cada grupo de control, con la estrategia de esta cola */
+  control_group *cgroups; /*!< Grupos de control, NULL si la cola no se divide en grupos */
+  int ncgroups;      /*!< Cantidad de grupos de control */
+  int runnable;      /*!< Procesos listos del grupo y sus descendientes (cola de un grupo de control) */
+  struct latency_histograms *latencies; /*!< Latencias de los procesos que terminan en la cola (ver latency.h) */
+} priority_queue;
+
+/** @brief Procesador (nucleo) de la topologia simulada */
+typedef struct
+{
+  int id;              /*!< Numero del procesador */
+  int socket;          /*!< Socket al que pertenece */
+  process *current;    /*!< Proceso en ejecucion, NULL si esta libre */
+  priority_queue *queue; /*!< Cola del proceso en ejecucion */
+  process *last;       /*!< Ultimo proceso que ejecuto en el procesador */
+  event *slice_end;    /*!< Fin del tramo en ejecucion */
+  int dispatch_time;   /*!< Tiempo desde el cual el proceso ejecuta, despues del sobrecosto */
+  long busy_time;      /*!< Tiempo de CPU util */
+} processor;
+
+/**
+ * @brief Rutina para la planificacion
+ * @param table Tabla de procesos.
+ * @param queues Arreglo de colas de prioridad.
+ * @param nqueues Cantidad de colas de prioridad.
+ * @param config Parametros de la simulacion.
+ */
+void schedule(process_table *table, priority_queue *queues, int nqueues, const sched_config *config);
+
+/**
+ * @brief Calcula la penalizacion por recargar la cache de un proceso
+ * @param config Parametros de la simulacion
+ * @param gap Tiempo que el proceso estuvo fuera de la CPU, -1 si no ha ejecutado
+ * @return Tiempo de recarga: crece con gap hasta reload_cost
+ */
+int reload_penalty(const sched_config *config, int gap);
+
+/**
+ * @brief Asigna los valores por defecto a los parametros de la simulacion
+ * @param config Parametros a inicializar
+ */
+void init_config(sched_config *config);
+
+/**
+ * @brief Crea una tabla de procesos vacia
+ * @return Nueva tabla de procesos
+ */
+process_table *create_process_table();
+
+/**
+ * @brief Crea un arreglo de colas de prioridad
+ * @param n Numero de colas de prioridad
+ * @return Arreglo de colas de prioridad
+ */
+priority_queue *create_queues(int n);
+
+/**
+ * @brief Vacia una cola de prioridad y sus estructuras para una nueva simulacion
+ * @param queue Cola de prioridad
+ * @param nprocesses Cantidad de procesos (tamano del sorteo de LOTTERY)
+ * @param seed Semilla del generador de sorteos
+ */
+void reset_queue(priority_queue *queue, int nprocesses, unsigned long long seed);
+
+/**
+ * @brief Imprime la informacion de una cola de prioridad
+ * @param queue Cola de prioridad a imprimir
+ */
+void print_queue(priority_queue *queue);
+
+/**
+ * @brief Retorna el numero de procesos listos en una cola de prioridad
+ * @param queues Colas de prioridad
+ * @param nqueues Numero de colas de prioridad
+ * @return Cantidad de procesos en estado de listo en todas las colas.
+ */
+int get_ready_count(priority_queue *queues, int nqueues);
+
+/**
+ * @brief Retorna el tiempo en el cual se presenta la nueva llegada a la cola de listos de una cola de prioridad
+ * @param queues Arreglo de colas de prioridad
+ * @param nqueues Cantidad de colas de prioridad
+ * @return Tiempo de llegada del nuevo proceso
+ */
+int get_next_arrival(priority_queue *queues, int nqueues);
+
+/**
+ * @brief Pasa a la cola de listos los procesos que esperan en la cola de llegada
+ * @param now Tiempo actual
+ * @param queues Arreglo de colas de prioridad
+ * @param nqueues Cantidad de colas de prioridad
+ * @param wheel Rueda de tiempo que recibe los eventos de envejecimiento
+ * @param config Parametros de la simulacion
+ * @return Cantidad de procesos que se pasaron a estado de listo
+ */
+int process_arrival(int now, priority_queue *queues, int nqueues, timing_wheel *wheel, const sched_config *config);
+
+/**
+ * @brief  Imprimir la informacion de un proceso
+ * @param p Proceso a imprimir
+ */
+void print_process(process *p);
+
+/**
+ * @brief Crea un nuevo proceso dentro de la tabla de procesos.
+ * @param table Tabla de procesos
+ * @param name Nombre del proceso
+ * @param arrival_time Tiempo de llegada
+ * @param execution_time Tiempo de ejecucion
+ * @return Nuevo proceso
+ * @note El proceso no se inserta en la lista ordenada por nombre.
+ */
+process *create_process(process_table *table, char *name, int arrival_time, int execution_time);
+
+/**
+ * @brief Crea un grupo de hilos dentro de la tabla de procesos.
+ * @param table Tabla de procesos
+ * @param name Nombre del grupo
+ * @param size Cantidad de hilos
+ * @param gang 1 si los hilos deben ejecutar simultaneamente
+ * @return Indice del grupo en table->groups; los hilos se asignan en threads
+ */
+int create_group(process_table *table, char *name, int size, int gang);
+
+/**
+ * @brief Reinicia un un proceso
+ * @param p Proceso
+ */
+void restart_process(process *p);
+
+/**
+ * @brief Compara dos procesos por tiempo de llegada.
+ * @param a Proceso A
+ * @param b Proceso B
+ * @return Resta de los tiempos de llegada de p2 y p1
+ */
+int compare_arrival(void *const a, void *const b);
+
+/**
+ * @brief Compara dos procesos siguiendo el criterio de SJF.
+ * @param a Proceso A
+ * @param b Proceso B
+ * @return Resta de los tiempos de llegada de p2 y p1
+ */
+int compare_sjf(void *const a, void *const b);
+
+/**
+ * @brief Compara dos procesos siguiendo el criterio de SRT.
+ * @param a Proceso A
+ * @param b Proceso B
+ * @return Resta de los tiempos de llegada de p2 y p1
+ */
+int compare_srt(void *const a, void *const b);
+
+/**
+ * @brief Compara dos procesos por tiempo de ejecucion virtual (CFS).
+ * @param a Proceso A
+ * @param b Proceso B
+ * @return Valor positivo si A tiene menor vruntime que B
+ */
+int compare_vruntime(void *const a, void *const b);
+
+/**
+ * @brief Compara dos procesos por deadline absoluto (EDF).
+ * @param a Proceso A
+ * @param b Proceso B
+ * @return Valor positivo si A tiene un deadline mas cercano que B
+ */
+int compare_deadline(void *const a, void *const b);
+
+/**
+ * @brief Compara dos procesos por valor de paso (STRIDE).
+ * @param a Proceso A
+ * @param b Proceso B
+ * @return Valor positivo si A tiene menor valor de paso que B
+ */
+int compare_pass(void *const a, void *const b);
+
+/**
+ * @brief Compara dos procesos por camino critico (CP).
+ * @param a Proceso A
+ * @param b Proceso B
+ * @return Valor positivo si A tiene un camino critico mas largo que B
+ */
+int compare_critical(void *const a, void *const b);
+
+/**
+ * @brief Calcula el deadline absoluto de un proceso
+ * @param p Proceso
+ * @return Tiempo de llegada mas deadline relativo, INT_MAX si no tiene deadline
+ */
+int absolute_deadline(process *p);
+
+/**
+ * @brief Prepara las estructuras de datos para la simulacion.
+ * @param processes Lista de procesos.
+ * @param queues Arreglo de colas de prioridad.
+ * @param nqueues Cantidad de colas de prioridad.
+ * @param wheel Rueda de tiempo que recibe los eventos de llegada.
+ * @param config Parametros de la simulacion.
+ */
+void prepare(list *processes, priority_queue *queues, int nqueues, timing_wheel *wheel, const sched_config *config);
+
+/**
+ * @brief  Calcula el tiempo total de la simulacion
+ * @param table Tabla de procesos
+ * @return Tiempo en el cual termina el ultimo proceso
+ */
+int max_scheduling_time(process_table *table);
+
+/**
+ * @brief Calcula el tiempo total de un proceso
+ * @param p Proceso a calcular el tiempo total
+ * @return Tiempo total de un proceso
+ */
+int process_scheduling_time(process *p);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,335 @@
+/**
+ * @file
+ * @brief Plantilla del ciclo principal de simulacion.
+ * @copyright MIT License
+ *
+ * Este archivo se incluye desde sched.c una vez por cada ciclo a generar,
+ * despues de definir:
+ *  - SCHED_LOOP: nombre de la funcion generada.
+ *  - SCHED_READY(q): cantidad de procesos listos en la cola q.
+ *  - SCHED_PICK(q): retira el siguiente proceso de la cola q.
+ *  - SCHED_SLICE(q, p): tiempo que p puede ejecutar antes de revisar la expropiacion.
+ *  - SCHED_ON_TICK(q, p, used): 1 si p debe ser expropiado tras used unidades.
+ *  - SCHED_ON_PREEMPT(q, p): devuelve p a la cola q.
+ * Las macros STATS_* de stats.h cuentan las operaciones sobre las colas; sin
+ * make STATS=1 no generan codigo.
+ * Las llegadas y los retornos de E/S se procesan con process_arrival(), que
+ * usa la operacion enqueue de cada cola. Un proceso expropiado vuelve a la cola indicada por
+ * su prioridad actual, que cambia con las reglas de MLFQ.
+ * Las colas son compartidas por todos los procesadores: cada procesador
+ * libre toma el siguiente proceso, y la politica de ubicacion decide en
+ * cual procesador libre ejecuta.
+ * Los hilos de un grupo gang=N se retiran de su cola y esperan a los demas
+ * hilos del grupo; el grupo completo reserva los procesadores libres hasta
+ * que puede ejecutar todos sus hilos a la vez.
+ */
+
+/**
+ * @brief Ciclo principal de simulacion por eventos discretos
+ * @param table Tabla de procesos
+ * @param queues Arreglo de colas de prioridad
+ * @param nqueues Cantidad de colas de prioridad
+ * @param sequence Secuencia de ejecucion
+ * @param wheel Rueda de tiempo con las llegadas programadas
+ * @param devices Dispositivos de E/S
+ * @param cpus Procesadores de la topologia
+ * @param ncpus Cantidad de procesadores
+ * @param config Parametros de la simulacion
+ * @param counters Contadores de eventos y expropiaciones
+ * @param series Serie de tiempo, NULL si no se registra
+ */
+static void SCHED_LOOP(process_table *table, priority_queue *queues, int nqueues, list *sequence,
+                       timing_wheel *wheel, io_device *devices, processor *cpus, int ncpus,
+                       const sched_config *config, sched_counters *counters, time_series *series)
+{
+  int i;
+  event *e;
+  int type;
+  process *p;
+  int current_time = 0;
+  process *current_process = NULL;
+  priority_queue *current_queue = NULL;
+  processor *c;
+  processor *victim;
+  int idle = ncpus;
+  int run;
+  preemption_mode rule;
+  preemption_mode victim_rule = PREEMPT_NONE;
+  process_group *g;
+  process_group *held = NULL;
+  int parked = 0;
+  int processes_finished = 0;
+  int total_processes = table->count;
+
+  if (config->boost > 0) {
+    wheel_schedule(wheel, config->boost, EV_BOOST, NULL);
+  }
+
+  while (processes_finished < total_processes) {
+
+    // PASO 1: Si hay procesadores libres y no quedan eventos en el tiempo actual, seleccionar procesos
+    if (idle > 0 && !wheel_due(wheel)) {
+      // Procesar llegadas ANTES de seleccionar
+      process_arrival(current_time, queues, nqueues, wheel, config);
+      while (idle > 0) {
+        current_process = NULL;
+        if (held != NULL) {
+          // El grupo completo espera un procesador libre para cada hilo
+          if (idle < held->parked) {
+            break;
+          }
+          // y que la cuota de su grupo de control alcance para el tiempo comun de todos los hilos
+          if (held->parked == held->size - held->finished && !reserve_gang(queues, held)) {
+            break;
+          }
+          current_process = unpark_thread(held);
+          current_queue = &queues[current_process->priority];
+          parked--;
+          if (held->parked == 0) {
+            held = NULL;
+          }
+        } else {
+          for (i = 0; i < nqueues && current_process == NULL; i++) {
+            if (SCHED_READY(&queues[i]) > 0) {
+              current_queue = &queues[i];
+              current_process = SCHED_PICK(current_queue);
+              STATS_COUNT(pops);
+            }
+          }
+          if (current_process == NULL) {
+            break;
+          }
+
+          // Un hilo de un grupo gang=N espera fuera de su cola a los demas hilos
+          g = gang_of(table, current_process, ncpus, config);
+          if (g != NULL) {
+            wheel_cancel(wheel, current_process->aging_timer);
+            current_process->aging_timer = NULL;
+            current_process->state = PARKED;
+            g->parked++;
+            parked++;
+            if (g->parked == g->size - g->finished) {
+              g->dispatches++;
+              counters->gang_dispatches++;
+              held = g;
+            }
+            continue;
+          }
+        }
+
+        // Tiempo de espera desde que el proceso quedo listo
+        account_wait(queues, current_process, current_time);
+        wheel_cancel(wheel, current_process->aging_timer);
+        current_process->aging_timer = NULL;
+        current_process->state = RUNNING;
+        if (current_process->first_run < 0) {
+          current_process->first_run = current_time;
+        }
+
+        // La politica de ubicacion elige el procesador libre
+        c = place_process(cpus, ncpus, current_process, config);
+        c->current = current_process;
+        c->queue = current_queue;
+        idle--;
+        if (ncpus > 1) {
+          trace(config, "[%d] Process %s started/resumed on CPU %d (remaining: %d)\n",
+                current_time, current_process->name, c->id + 1, current_process->remaining_time);
+        } else {
+          trace(config, "[%d] Process %s started/resumed (remaining: %d)\n",
+                current_time, current_process->name, current_process->remaining_time);
+        }
+
+        // El proceso ejecuta despues del cambio de contexto, la migracion y la recarga de su cache
+        c->dispatch_time = current_time + dispatch_overhead(cpus, c, current_process, current_time, config, counters);
+        c->last = current_process;
+        current_process->cpu = c->id;
+
+        // PASO 2: Programar el fin de la ejecucion (fin de la rafaga o quantum)
+        run = SCHED_SLICE(current_queue, current_process);
+        if (current_process->burst_left <= run) {
+          c->slice_end = wheel_schedule(wheel, c->dispatch_time + current_process->burst_left, EV_COMPLETION, current_process);
+        } else {
+          c->slice_end = wheel_schedule(wheel, c->dispatch_time + run, EV_QUANTUM, current_process);
+        }
+      }
+    }
+
+    // PASO 3: Avanzar hasta el siguiente evento
+    e = wheel_pop(wheel);
+    if (e == NULL) {
+      break;
+    }
+    counters->events++;
+    // Procesadores libres que podrian ejecutar hilos que esperan a su grupo
+    counters->gang_idle += (long)min(idle, parked) * (e->time - current_time);
+    // El estado desde el evento anterior se mantiene hasta este evento
+    if (series != NULL) {
+      advance_series(series, queues, ncpus - idle, e->time);
+    }
+    if (e->time > current_time) {
+      export_depth(queues, current_time);
+    }
+    current_time = e->time;
+    type = e->type;
+    p = (process *)e->data;
+    wheel_release(wheel, e);
+
+    if (type == EV_AGING) {
+      age_process(queues, p, current_time, wheel, config, counters);
+      continue;
+    }
+    if (type == EV_BOOST) {
+      boost_queues(queues, nqueues, cpus, ncpus, current_time, config, counters);
+      wheel_schedule(wheel, current_time + config->boost, EV_BOOST, NULL);
+      continue;
+    }
+
+    if (type == EV_PERIOD) {
+      refill_cgroups(&queues[0], current_time, wheel, config);
+      continue;
+    }
+
+    if (type == EV_IO) {
+      complete_io(devices, p, current_time, wheel, config);
+    }
+
+    if (type == EV_ARRIVAL && series != NULL) {
+      series->arrivals++;
+    }
+    if (type == EV_ARRIVAL || type == EV_IO) {
+      push_back(queues[p->priority].arrival, p);
+      if (config->preemption == PREEMPT_NONE) {
+        // El proceso espera en la cola de llegada hasta que un procesador quede libre
+        continue;
+      }
+
+      // Admitir el proceso en su tiempo de llegada; si hay un procesador libre, no se expropia
+      process_arrival(current_time, queues, nqueues, wheel, config);
+      if (idle > 0) {
+        continue;
+      }
+
+      // Expropiar al proceso de menor prioridad entre los que la regla permite expropiar.
+      // Un cambio de contexto en curso no se interrumpe.
+      victim = NULL;
+      for (i = 0; i < ncpus; i++) {
+        c = &cpus[i];
+        if (current_time < c->dispatch_time || gang_of(table, c->current, ncpus, config) != NULL) {
+          continue;
+        }
+        rule = preemption_rule(config, queues, c->current,
+                               c->current->remaining_time - (current_time - c->dispatch_time), p);
+        if (rule != PREEMPT_NONE && (victim == NULL || c->current->priority > victim->current->priority)) {
+          victim = c;
+          victim_rule = rule;
+        }
+      }
+      if (victim == NULL) {
+        continue;
+      }
+      c = victim;
+      current_process = c->current;
+      wheel_cancel(wheel, c->slice_end);
+      account_cpu(queues, c, sequence, current_time, config);
+      SCHED_ON_PREEMPT(&queues[current_process->priority], current_process);
+      STATS_COUNT(inserts);
+      make_ready(current_process, current_time, wheel, config);
+      if (victim_rule == PREEMPT_PRIORITY) {
+        counters->priority++;
+        export_preemption(current_process, current_time, "priority", p);
+      } else if (victim_rule == PREEMPT_SRT) {
+        counters->srt++;
+        export_preemption(current_process, current_time, "srt", p);
+      } else {
+        counters->edf++;
+        export_preemption(current_process, current_time, "edf", p);
+      }
+      trace(config, "[%d] Process %s preempted by %s (remaining: %d)\n",
+            current_time, current_process->name, p->name, current_process->remaining_time);
+      c->current = NULL;
+      idle++;
+      continue;
+    }
+
+    // PASO 4: Contabilizar la ejecucion desde la asignacion de la CPU
+    c = &cpus[p->cpu];
+    current_process = c->current;
+    current_queue = c->queue;
+    account_cpu(queues, c, sequence, current_time, config);
+
+    // PASO 5: Verificar si proceso terminó
+    if (current_process->remaining_time <= 0) {
+      current_process->state = FINISHED;
+      current_process->finished_time = current_time;
+      if (current_process->group >= 0) {
+        table->groups[current_process->group].finished++;
+      }
+      // Si los demas hilos esperaban a este hilo, vuelven a su cola y completan el grupo al ser elegidos
+      g = gang_of(table, current_process, ncpus, config);
+      if (g != NULL && g->parked > 0 && g->parked == g->size - g->finished) {
+        while (g->parked > 0) {
+          p = unpark_thread(g);
+          p->state = READY;
+          SCHED_ON_PREEMPT(&queues[p->priority], p);
+          STATS_COUNT(inserts);
+          parked--;
+        }
+      }
+      leave_share(queues, current_process);
+      push_back(current_queue->finished, current_process);
+      record_latencies(current_queue->latencies, current_process);
+      if (series != NULL) {
+        series->completions++;
+      }
+      trace(config, "[%d] Process %s finished\n", current_time, current_process->name);
+      release_successors(current_process, current_time, wheel);
+      c->current = NULL;
+      idle++;
+      processes_finished++;
+    }
+    // Al terminar una rafaga de CPU, el proceso se bloquea en su dispositivo de E/S
+    else if (current_process->burst_left <= 0) {
+      block_process(queues, devices, current_process, current_time, wheel, config);
+      c->current = NULL;
+      idle++;
+    }
+    // PASO 6: Verificar expropiación de la estrategia (quantum en RR)
+    // Los hilos de un grupo gang=N dejan la CPU juntos al terminar su tiempo comun
+    else if (gang_of(table, current_process, ncpus, config) != NULL ||
+             SCHED_ON_TICK(current_queue, current_process, current_time - c->dispatch_time)) {
+      counters->quantum++;
+      export_preemption(current_process, current_time, "quantum", NULL);
+      trace(config, "[%d] Process %s preempted (quantum expired, remaining: %d)\n",
+            current_time, current_process->name, current_process->remaining_time);
+      // MLFQ: el proceso que agota su quantum baja a la siguiente cola; no si solo se agoto la cuota de su grupo
+      if (config->mlfq && current_process->priority < nqueues - 1 &&
+          !quota_exhausted(current_queue, current_process, current_time - c->dispatch_time)) {
+        current_process->priority++;
+        counters->demotions++;
+        trace(config, "[%d] Process %s demoted to queue %d\n",
+              current_time, current_process->name, current_process->priority + 1);
+      }
+      SCHED_ON_PREEMPT(&queues[current_process->priority], current_process);
+      STATS_COUNT(inserts);
+      make_ready(current_process, current_time, wheel, config);
+      c->current = NULL;
+      idle++;
+    }
+    else {
+      // La estrategia no expropia: continuar con un nuevo tramo
+      c->dispatch_time = current_time;
+      run = SCHED_SLICE(current_queue, current_process);
+      c->slice_end = wheel_schedule(wheel, current_time + min(run, current_process->burst_left),
+                                    (current_process->burst_left <= run) ? EV_COMPLETION : EV_QUANTUM, current_process);
+    }
+  }
+  export_depth(queues, current_time);
+  STATS_ADD(ticks, current_time);
+}
+
+#undef SCHED_LOOP
+#undef SCHED_READY
+#undef SCHED_PICK
+#undef SCHED_SLICE
+#undef SCHED_ON_TICK
+#undef SCHED_ON_PREEMPT
@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @brief Metricas de reparto proporcional: CPU solicitada contra CPU recibida.
+ * @copyright MIT License
+ */
+
+#include <math.h>
+#include <stdio.h>
+
+#include "share.h"
+
+/**
+ * @brief Verifica si una estrategia reparte la CPU de acuerdo con los boletos
+ * @param s Estrategia
+ * @return 1 si la estrategia es LOTTERY o STRIDE
+ */
+static int proportional(strategy s)
+{
+  return s == LOTTERY || s == STRIDE;
+}
+
+void print_share_report(process_table *table, priority_queue *queues, int nqueues, const sched_config *config)
+{
+  process *p;
+  int i;
+  int q;
+  int n;
+  double ratio;
+  double error;
+  double requested;
+
+  for (q = 0; q < nqueues; q++)
+  {
+    if (!proportional(queues[q].strategy))
+    {
+      continue;
+    }
+
+    n = 0;
+    error = 0.0;
+    requested = 0.0;
+    for (i = 0; i < table->count; i++)
+    {
+      p = table_process(table, i);
+      if (p->base_priority != q)
+      {
+        continue;
+      }
+      if (n == 0)
+      {
+        printf("\nProportional share (queue %d)\n", q + 1);
+        if (!config->quiet)
+        {
+          printf("%-20s %8s %10s %10s %7s\n", "Process", "Tickets", "Requested", "Achieved", "Ratio");
+        }
+      }
+      // Con DEFINE quiet on no se listan los procesos, solo la desviacion de la cola
+      if (!config->quiet)
+      {
+        ratio = (p->entitled > 0) ? p->cpu_time / p->entitled : 1.0;
+        printf("%-20s %8d %10.2f %10d %7.3f\n", p->name, p->tickets, p->entitled, p->cpu_time, ratio);
+      }
+      error += fabs(p->cpu_time - p->entitled);
+      requested += p->entitled;
+      n++;
+    }
+    // Los procesos cortos tienen razones extremas: la desviacion se pondera por la CPU solicitada
+    if (n > 0 && requested > 0)
+    {
+      printf("Share deviation: %.2f%% of the queue CPU (sum |achieved - requested| / sum requested)\n",
+             100.0 * error / requested);
+    }
+  }
+}
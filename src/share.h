@@ -0,0 +1,27 @@
+#ifndef SHARE_H
+#define SHARE_H
+
+/**
+ * @file
+ * @brief Metricas de reparto proporcional: CPU solicitada contra CPU recibida.
+ * @copyright MIT License
+ *
+ * En las colas LOTTERY y STRIDE cada proceso solicita una fraccion de la CPU
+ * proporcional a sus boletos. Mientras un proceso esta admitido, cada unidad
+ * de CPU que recibe su cola le corresponde en la proporcion
+ * boletos / boletos activos. La suma de estas fracciones es la CPU solicitada,
+ * que se compara con el tiempo de CPU que el proceso recibio.
+ */
+
+#include "sched.h"
+
+/**
+ * @brief Imprime la CPU solicitada y recibida por los procesos de las colas LOTTERY y STRIDE
+ * @param table Tabla de procesos simulados
+ * @param queues Arreglo de colas de prioridad
+ * @param nqueues Cantidad de colas de prioridad
+ * @param config Configuracion de la simulacion; con quiet solo se imprime la desviacion de cada cola
+ */
+void print_share_report(process_table *table, priority_queue *queues, int nqueues, const sched_config *config);
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @brief Contadores y tiempos del simulador, removibles en compilacion.
+ * @copyright MIT License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "stats.h"
+
+#ifdef SCHED_STATS
+
+sched_stats stats;
+
+/** @brief Funciones originales de la biblioteca de C, con -Wl,--wrap */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+/** @brief Cuenta una asignacion y llama a malloc */
+void *__wrap_malloc(size_t size)
+{
+  stats.allocations++;
+  stats.bytes += size;
+  return __real_malloc(size);
+}
+
+/** @brief Cuenta una asignacion y llama a calloc */
+void *__wrap_calloc(size_t n, size_t size)
+{
+  stats.allocations++;
+  stats.bytes += n * size;
+  return __real_calloc(n, size);
+}
+
+/** @brief Cuenta una asignacion y llama a realloc */
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  stats.allocations++;
+  stats.bytes += size;
+  return __real_realloc(ptr, size);
+}
+
+/**
+ * @brief Tiempo del reloj monotono
+ * @return Segundos
+ */
+static double seconds(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+void stats_begin(stats_phase phase)
+{
+  stats.started[phase] = seconds();
+}
+
+void stats_end(stats_phase phase)
+{
+  if (stats.started[phase] > 0)
+  {
+    stats.elapsed[phase] += seconds() - stats.started[phase];
+    stats.started[phase] = 0;
+  }
+}
+
+void print_stats(void)
+{
+  static const char *names[STATS_PHASES] = {"parse", "prepare", "simulate", "report", "plot"};
+  double total;
+  int i;
+
+  // Cerrar las fases en curso, como la lectura al llegar al fin del archivo
+  total = 0;
+  for (i = 0; i < STATS_PHASES; i++)
+  {
+    stats_end((stats_phase)i);
+    total += stats.elapsed[i];
+  }
+
+  fprintf(stderr, "\nStatistics\n");
+  for (i = 0; i < STATS_PHASES; i++)
+  {
+    fprintf(stderr, "%-10s %10.6f s %5.1f%%\n", names[i], stats.elapsed[i],
+            (total > 0) ? 100.0 * stats.elapsed[i] / total : 0.0);
+  }
+  fprintf(stderr, "Events: %llu (%.0f per second of simulation), simulated time: %llu\n", stats.events,
+          (stats.elapsed[STATS_SIMULATE] > 0) ? stats.events / stats.elapsed[STATS_SIMULATE] : 0.0, stats.ticks);
+  fprintf(stderr, "Dispatches: %llu, context switches: %llu\n", stats.dispatches, stats.switches);
+  fprintf(stderr, "Ready queue inserts: %llu, pops: %llu\n", stats.inserts, stats.pops);
+  fprintf(stderr, "Allocations: %llu (%llu bytes, %.2f per event)\n", stats.allocations, stats.bytes,
+          (stats.events > 0) ? (double)stats.allocations / stats.events : 0.0);
+}
+
+#else
+
+void print_stats(void)
+{
+  fprintf(stderr, "Statistics are not available, rebuild with make clean && make STATS=1\n");
+}
+
+#endif
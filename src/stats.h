@@ -0,0 +1,85 @@
+#ifndef STATS_H
+#define STATS_H
+
+/**
+ * @file
+ * @brief Contadores y tiempos del simulador, removibles en compilacion.
+ * @copyright MIT License
+ *
+ * Con make STATS=1 se define SCHED_STATS: las macros STATS_* actualizan
+ * contadores globales, y las fases se miden con un reloj monotono solo en sus
+ * limites, no en cada evento. Las asignaciones de memoria se cuentan con las
+ * opciones -Wl,--wrap del enlazador. Sin SCHED_STATS las macros no generan
+ * codigo.
+ *
+ * ./scheduler --stats archivo imprime el reporte al terminar el programa.
+ */
+
+/** @brief Fases medidas */
+typedef enum
+{
+  STATS_PARSE,    /*!< Lectura de la configuracion */
+  STATS_PREPARE,  /*!< Preparacion de las colas, procesos y grupos */
+  STATS_SIMULATE, /*!< Ciclo de simulacion o aproximacion */
+  STATS_REPORT,   /*!< Impresion de los resultados */
+  STATS_PLOT,     /*!< Creacion de la grafica */
+  STATS_PHASES    /*!< Cantidad de fases */
+} stats_phase;
+
+/** @brief Contadores y tiempos acumulados del programa */
+typedef struct
+{
+  double elapsed[STATS_PHASES];  /*!< Tiempo de pared de cada fase, en segundos */
+  double started[STATS_PHASES];  /*!< Inicio de la fase en curso, 0 si no esta en curso */
+  unsigned long long events;     /*!< Eventos simulados */
+  unsigned long long ticks;      /*!< Unidades de tiempo simuladas */
+  unsigned long long dispatches; /*!< Asignaciones de la CPU */
+  unsigned long long switches;   /*!< Cambios de contexto (asignaciones a un proceso distinto del anterior) */
+  unsigned long long inserts;    /*!< Inserciones en las colas de listos */
+  unsigned long long pops;       /*!< Procesos retirados de las colas de listos */
+  unsigned long long allocations; /*!< Llamadas a malloc, calloc y realloc */
+  unsigned long long bytes;      /*!< Bytes solicitados a malloc, calloc y realloc */
+} sched_stats;
+
+#ifdef SCHED_STATS
+
+/** @brief Contadores del programa */
+extern sched_stats stats;
+
+/**
+ * @brief Inicia la medicion de una fase
+ * @param phase Fase
+ */
+void stats_begin(stats_phase phase);
+
+/**
+ * @brief Termina la medicion de una fase y acumula su tiempo
+ * @param phase Fase
+ */
+void stats_end(stats_phase phase);
+
+/** @brief Inicia la medicion de una fase */
+#define STATS_BEGIN(phase) stats_begin(phase)
+/** @brief Termina la medicion de una fase */
+#define STATS_END(phase) stats_end(phase)
+/** @brief Suma n a un contador */
+#define STATS_ADD(counter, n) (stats.counter += (unsigned long long)(n))
+
+#else
+
+#define STATS_BEGIN(phase) ((void)0)
+#define STATS_END(phase) ((void)0)
+#define STATS_ADD(counter, n) ((void)0)
+
+#endif
+
+/** @brief Incrementa un contador */
+#define STATS_COUNT(counter) STATS_ADD(counter, 1)
+
+/**
+ * @brief Imprime el reporte en la salida de error, o un aviso si se compilo sin SCHED_STATS.
+ * Se registra con atexit() para imprimirse al terminar el programa.
+ */
+void print_stats(void);
+
+#endif
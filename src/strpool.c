@@ -0,0 +1,151 @@
+/**
+ * @file
+ * @brief Almacen de cadenas internadas
+ * @copyright MIT License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "strpool.h"
+
+/** @brief Capacidad inicial de la tabla hash */
+#define POOL_INITIAL_SLOTS 64
+
+/** @brief Tamano minimo de un bloque de almacenamiento */
+#define POOL_BLOCK_SIZE 65536
+
+/**
+ * @brief Funcion hash FNV-1a
+ * @param str Cadena
+ * @return Valor hash de la cadena
+ */
+static unsigned int hash_string(const char *str)
+{
+  unsigned int h = 2166136261u;
+
+  while (*str != '\0')
+  {
+    h ^= (unsigned char)*str++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+/**
+ * @brief Duplica la capacidad de la tabla hash
+ * @param pool Almacen de cadenas
+ */
+static void grow_slots(string_pool *pool)
+{
+  const char **old;
+  int old_capacity;
+  int i;
+  unsigned int j;
+
+  old = pool->slots;
+  old_capacity = pool->capacity;
+
+  pool->capacity *= 2;
+  pool->slots = (const char **)calloc(pool->capacity, sizeof(const char *));
+
+  for (i = 0; i < old_capacity; i++)
+  {
+    if (old[i] == 0)
+    {
+      continue;
+    }
+    j = hash_string(old[i]) & (pool->capacity - 1);
+    while (pool->slots[j] != 0)
+    {
+      j = (j + 1) & (pool->capacity - 1);
+    }
+    pool->slots[j] = old[i];
+  }
+  free(old);
+}
+
+/**
+ * @brief Copia una cadena dentro de los bloques del almacen
+ * @param pool Almacen de cadenas
+ * @param str Cadena a copiar
+ * @return Copia de la cadena
+ */
+static const char *store_string(string_pool *pool, const char *str)
+{
+  pool_block *b;
+  int len;
+  int size;
+  char *ret;
+
+  len = strlen(str) + 1;
+  b = pool->blocks;
+  if (b == 0 || b->size - b->used < len)
+  {
+    size = (len > POOL_BLOCK_SIZE) ? len : POOL_BLOCK_SIZE;
+    b = (pool_block *)malloc(sizeof(pool_block) + size);
+    b->next = pool->blocks;
+    b->used = 0;
+    b->size = size;
+    pool->blocks = b;
+  }
+  ret = b->data + b->used;
+  memcpy(ret, str, len);
+  b->used += len;
+  return ret;
+}
+
+string_pool *create_string_pool()
+{
+  string_pool *ret;
+
+  ret = (string_pool *)malloc(sizeof(string_pool));
+  ret->capacity = POOL_INITIAL_SLOTS;
+  ret->slots = (const char **)calloc(ret->capacity, sizeof(const char *));
+  ret->count = 0;
+  ret->blocks = 0;
+  return ret;
+}
+
+const char *intern(string_pool *pool, const char *str)
+{
+  unsigned int j;
+
+  // Mantener la tabla hash a menos de la mitad de su capacidad
+  if (2 * (pool->count + 1) > pool->capacity)
+  {
+    grow_slots(pool);
+  }
+
+  j = hash_string(str) & (pool->capacity - 1);
+  while (pool->slots[j] != 0)
+  {
+    if (strcmp(pool->slots[j], str) == 0)
+    {
+      return pool->slots[j];
+    }
+    j = (j + 1) & (pool->capacity - 1);
+  }
+
+  pool->slots[j] = store_string(pool, str);
+  pool->count++;
+  return pool->slots[j];
+}
+
+void destroy_string_pool(string_pool *pool)
+{
+  pool_block *b;
+  pool_block *aux;
+
+  if (pool == 0)
+  {
+    return;
+  }
+  for (b = pool->blocks; b != 0; b = aux)
+  {
+    aux = b->next;
+    free(b);
+  }
+  free(pool->slots);
+  free(pool);
+}
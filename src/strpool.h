@@ -0,0 +1,52 @@
+/**
+ * @file
+ * @brief Almacen de cadenas internadas
+ * @copyright MIT License
+ *
+ * Cada cadena distinta se almacena una sola vez, en bloques contiguos.
+ * Dos cadenas internadas en el mismo almacen son iguales si y solo si sus
+ * apuntadores son iguales.
+ */
+
+#ifndef STRPOOL_H
+#define STRPOOL_H
+
+/** @brief Bloque de almacenamiento de cadenas */
+typedef struct pool_block
+{
+  struct pool_block *next; /*!< Bloque anterior */
+  int used;                /*!< Bytes usados */
+  int size;                /*!< Capacidad en bytes */
+  char data[];             /*!< Cadenas almacenadas */
+} pool_block;
+
+/** @brief Almacen de cadenas internadas */
+typedef struct
+{
+  const char **slots; /*!< Tabla hash (direccionamiento abierto) */
+  int capacity;       /*!< Cantidad de entradas de la tabla hash */
+  int count;          /*!< Cantidad de cadenas distintas */
+  pool_block *blocks; /*!< Bloques de almacenamiento */
+} string_pool;
+
+/**
+ * @brief Crea un almacen de cadenas vacio
+ * @return Nuevo almacen
+ */
+string_pool *create_string_pool();
+
+/**
+ * @brief Obtiene la copia internada de una cadena
+ * @param pool Almacen de cadenas
+ * @param str Cadena a internar
+ * @return Copia unica de la cadena dentro del almacen
+ */
+const char *intern(string_pool *pool, const char *str);
+
+/**
+ * @brief Libera el almacen y todas sus cadenas
+ * @param pool Almacen a liberar
+ */
+void destroy_string_pool(string_pool *pool);
+
+#endif
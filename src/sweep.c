@@ -0,0 +1,462 @@
+/**
+ * @file
+ * @brief Simulacion por lotes de varios valores de quantum en paralelo.
+ * @copyright MIT License
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sweep.h"
+
+/** @brief Quantum efectivo de una cola que no expropia */
+#define NO_QUANTUM INT_MAX
+
+/** @brief Estado de un lote de carriles */
+typedef struct
+{
+  int n;           /*!< Cantidad de procesos */
+  int nqueues;     /*!< Cantidad de colas de prioridad */
+  int lanes;       /*!< Carriles en uso */
+  int *arrival;    /*!< Tiempo de llegada de cada proceso */
+  int *execution;  /*!< Tiempo de ejecucion de cada proceso */
+  strategy *strat; /*!< Estrategia de cada cola */
+  int *fixed;      /*!< Quantum de las colas que no hacen parte del barrido */
+  int *qcount;     /*!< Cantidad de procesos de cada cola */
+  int **order;     /*!< Procesos de cada cola ordenados por llegada */
+  const sched_config *config; /*!< Costos de cambio de contexto y recarga de cache */
+
+  /* Estado por proceso: [proceso * SWEEP_LANES + carril] */
+  int *remaining; /*!< Tiempo restante */
+  int *cpu;       /*!< Tiempo de CPU asignado */
+  int *left;      /*!< Tiempo en el que dejo la CPU, -1 si no ha ejecutado */
+
+  /* Estado por cola: [cola * SWEEP_LANES + carril] */
+  int *quantum;     /*!< Quantum efectivo */
+  int *next_arrival; /*!< Siguiente llegada pendiente */
+  int **ready;      /*!< Colas de listos (buffer circular por carril) */
+  int *ready_head;  /*!< Inicio de la cola de listos */
+  int *ready_count; /*!< Cantidad de procesos listos */
+
+  /* Estado por carril */
+  int cur[SWEEP_LANES];      /*!< Proceso en ejecucion, -1 si la CPU esta libre */
+  int cur_queue[SWEEP_LANES]; /*!< Cola del proceso en ejecucion */
+  int run_rem[SWEEP_LANES];  /*!< Tiempo restante del proceso en ejecucion */
+  int run_cpu[SWEEP_LANES];  /*!< Tiempo de CPU del proceso en ejecucion */
+  int used[SWEEP_LANES];     /*!< Quantum consumido */
+  int limit[SWEEP_LANES];    /*!< Quantum efectivo del proceso en ejecucion */
+  int running[SWEEP_LANES];  /*!< 1 si el carril tiene un proceso en ejecucion */
+  int done[SWEEP_LANES];     /*!< Procesos terminados */
+  int stall[SWEEP_LANES];    /*!< Tiempo de cambio de contexto y recarga pendiente */
+  int last[SWEEP_LANES];     /*!< Ultimo proceso que tuvo la CPU, -1 si ninguno */
+} sweep_batch;
+
+/**
+ * @brief Inserta un proceso en la cola de listos de un carril
+ * @param b Lote
+ * @param q Cola de prioridad
+ * @param l Carril
+ * @param idx Proceso
+ */
+static void ready_insert(sweep_batch *b, int q, int l, int idx)
+{
+  int *buf = b->ready[q] + l * b->qcount[q];
+  int cap = b->qcount[q];
+  int h = b->ready_head[q * SWEEP_LANES + l];
+  int count = b->ready_count[q * SWEEP_LANES + l];
+  int pos;
+  int j;
+  int other;
+  int cmp;
+
+  pos = count;
+  if (b->strat[q] == SJF || b->strat[q] == SRT)
+  {
+    // Mismo criterio de insert_ordered con compare_sjf / compare_srt
+    for (pos = 0; pos < count; pos++)
+    {
+      other = buf[(h + pos) % cap];
+      if (b->strat[q] == SJF && b->cpu[other * SWEEP_LANES + l] > 0)
+      {
+        cmp = -1;
+      }
+      else
+      {
+        cmp = b->remaining[other * SWEEP_LANES + l] - b->remaining[idx * SWEEP_LANES + l];
+      }
+      if (cmp > 0)
+      {
+        break;
+      }
+    }
+    for (j = count; j > pos; j--)
+    {
+      buf[(h + j) % cap] = buf[(h + j - 1) % cap];
+    }
+  }
+  buf[(h + pos) % cap] = idx;
+  b->ready_count[q * SWEEP_LANES + l] = count + 1;
+}
+
+/**
+ * @brief Pasa a listos los procesos que han llegado en un carril
+ * @param b Lote
+ * @param l Carril
+ * @param now Tiempo actual
+ */
+static void lane_arrival(sweep_batch *b, int l, int now)
+{
+  int q;
+  int *next;
+
+  for (q = 0; q < b->nqueues; q++)
+  {
+    next = &b->next_arrival[q * SWEEP_LANES + l];
+    while (*next < b->qcount[q] && b->arrival[b->order[q][*next]] <= now)
+    {
+      ready_insert(b, q, l, b->order[q][*next]);
+      (*next)++;
+    }
+  }
+}
+
+/**
+ * @brief Asigna la CPU de un carril al primer proceso listo
+ * @param b Lote
+ * @param l Carril
+ * @param now Tiempo actual
+ * @param r Resultado del carril (asignaciones y sobrecosto)
+ */
+static void lane_dispatch(sweep_batch *b, int l, int now, sweep_result *r)
+{
+  int q;
+  int idx;
+  int *h;
+  int left;
+
+  for (q = 0; q < b->nqueues; q++)
+  {
+    if (b->ready_count[q * SWEEP_LANES + l] == 0)
+    {
+      continue;
+    }
+    h = &b->ready_head[q * SWEEP_LANES + l];
+    idx = b->ready[q][l * b->qcount[q] + *h];
+    *h = (*h + 1) % b->qcount[q];
+    b->ready_count[q * SWEEP_LANES + l]--;
+
+    b->cur[l] = idx;
+    b->cur_queue[l] = q;
+    b->run_rem[l] = b->remaining[idx * SWEEP_LANES + l];
+    b->run_cpu[l] = b->cpu[idx * SWEEP_LANES + l];
+    b->used[l] = 0;
+    b->limit[l] = b->quantum[q * SWEEP_LANES + l];
+    b->running[l] = 1;
+    r->dispatches++;
+
+    // Mismo costo que la simulacion exacta: cambio de contexto y recarga de la cache
+    b->stall[l] = (idx != b->last[l]) ? b->config->switch_cost : 0;
+    left = b->left[idx * SWEEP_LANES + l];
+    b->stall[l] += reload_penalty(b->config, (left < 0) ? -1 : now - left);
+    b->last[l] = idx;
+    r->overhead += b->stall[l];
+    return;
+  }
+}
+
+/**
+ * @brief Tiempo hasta la siguiente llegada de un carril
+ * @param b Lote
+ * @param l Carril
+ * @param now Tiempo actual
+ * @return Tiempo hasta la siguiente llegada, INT_MAX si no hay mas llegadas
+ */
+static int lane_next_arrival(sweep_batch *b, int l, int now)
+{
+  int q;
+  int next;
+  int ret;
+
+  ret = INT_MAX;
+  for (q = 0; q < b->nqueues; q++)
+  {
+    next = b->next_arrival[q * SWEEP_LANES + l];
+    if (next < b->qcount[q] && b->arrival[b->order[q][next]] - now < ret)
+    {
+      ret = b->arrival[b->order[q][next]] - now;
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief Simula un lote de hasta SWEEP_LANES valores de quantum
+ * @param b Lote, con los datos de la carga de trabajo inicializados
+ * @param queue Cola cuyo quantum varia
+ * @param quanta Valores de quantum del lote
+ * @param r Resultados del lote
+ */
+static void run_batch(sweep_batch *b, int queue, int *quanta, sweep_result *r)
+{
+  int i;
+  int l;
+  int q;
+  int now;
+  int step;
+  int live;
+  int idx;
+  int lane_step[SWEEP_LANES];
+  int work[SWEEP_LANES];
+
+  for (i = 0; i < b->n * SWEEP_LANES; i++)
+  {
+    b->remaining[i] = b->execution[i / SWEEP_LANES];
+    b->cpu[i] = 0;
+    b->left[i] = -1;
+  }
+  for (q = 0; q < b->nqueues; q++)
+  {
+    for (l = 0; l < SWEEP_LANES; l++)
+    {
+      b->next_arrival[q * SWEEP_LANES + l] = 0;
+      b->ready_head[q * SWEEP_LANES + l] = 0;
+      b->ready_count[q * SWEEP_LANES + l] = 0;
+      b->quantum[q * SWEEP_LANES + l] = b->fixed[q];
+      if (q == queue && l < b->lanes && b->strat[q] == RR)
+      {
+        b->quantum[q * SWEEP_LANES + l] = (quanta[l] > 0) ? quanta[l] : NO_QUANTUM;
+      }
+    }
+  }
+  for (l = 0; l < SWEEP_LANES; l++)
+  {
+    b->cur[l] = -1;
+    b->running[l] = 0;
+    b->used[l] = 0;
+    b->run_rem[l] = 0;
+    b->run_cpu[l] = 0;
+    b->limit[l] = NO_QUANTUM;
+    b->stall[l] = 0;
+    b->last[l] = -1;
+    b->done[l] = (l < b->lanes) ? 0 : b->n;
+    if (l < b->lanes)
+    {
+      r[l].quantum = quanta[l];
+      r[l].total_waiting = 0;
+      r[l].total_turnaround = 0;
+      r[l].makespan = 0;
+      r[l].dispatches = 0;
+      r[l].overhead = 0;
+    }
+  }
+
+  now = 0;
+  live = (b->n > 0) ? b->lanes : 0;
+  while (live > 0)
+  {
+    // Asignar la CPU en los carriles libres (escalar)
+    for (l = 0; l < b->lanes; l++)
+    {
+      if (b->done[l] < b->n && !b->running[l])
+      {
+        lane_arrival(b, l, now);
+        lane_dispatch(b, l, now, &r[l]);
+      }
+    }
+
+    // Tiempo hasta el siguiente evento de cada carril
+    for (l = 0; l < SWEEP_LANES; l++)
+    {
+      lane_step[l] = min(b->run_rem[l], b->limit[l] - b->used[l]);
+      lane_step[l] = (b->stall[l] > 0) ? b->stall[l] : lane_step[l];
+      lane_step[l] = b->running[l] ? lane_step[l] : INT_MAX;
+    }
+    for (l = 0; l < b->lanes; l++)
+    {
+      if (b->done[l] < b->n && !b->running[l])
+      {
+        lane_step[l] = lane_next_arrival(b, l, now);
+      }
+    }
+    step = INT_MAX;
+    for (l = 0; l < SWEEP_LANES; l++)
+    {
+      step = min(step, lane_step[l]);
+    }
+
+    // Avanzar todos los carriles juntos (vectorizable); un carril en cambio de contexto no avanza
+    for (l = 0; l < SWEEP_LANES; l++)
+    {
+      work[l] = b->running[l] * (b->stall[l] == 0);
+      b->run_rem[l] -= step * work[l];
+      b->run_cpu[l] += step * work[l];
+      b->used[l] += step * work[l];
+      b->stall[l] -= step * (b->stall[l] > 0);
+    }
+    now += step;
+
+    // Procesar finalizaciones y expropiaciones (escalar)
+    for (l = 0; l < b->lanes; l++)
+    {
+      if (!b->running[l])
+      {
+        continue;
+      }
+      idx = b->cur[l];
+      if (b->run_rem[l] <= 0)
+      {
+        b->remaining[idx * SWEEP_LANES + l] = 0;
+        b->cpu[idx * SWEEP_LANES + l] = b->run_cpu[l];
+        r[l].total_turnaround += now - b->arrival[idx];
+        r[l].total_waiting += now - b->arrival[idx] - b->execution[idx];
+        b->left[idx * SWEEP_LANES + l] = now;
+        r[l].makespan = now;
+        b->running[l] = 0;
+        b->cur[l] = -1;
+        if (++b->done[l] == b->n)
+        {
+          live--;
+        }
+      }
+      else if (b->used[l] >= b->limit[l])
+      {
+        b->remaining[idx * SWEEP_LANES + l] = b->run_rem[l];
+        b->cpu[idx * SWEEP_LANES + l] = b->run_cpu[l];
+        b->left[idx * SWEEP_LANES + l] = now;
+        b->running[l] = 0;
+        b->cur[l] = -1;
+        ready_insert(b, b->cur_queue[l], l, idx);
+      }
+    }
+  }
+
+  // El tiempo de cambio de contexto y recarga no es tiempo de espera
+  for (l = 0; l < b->lanes; l++)
+  {
+    r[l].total_waiting -= r[l].overhead;
+  }
+}
+
+/**
+ * @brief Compara dos procesos por llegada, y por posicion si empatan
+ * @param a Apuntador al indice A
+ * @param b Apuntador al indice B
+ * @param arrival Tiempos de llegada
+ * @return < 0 si a llega antes que b
+ */
+static int compare_index_arrival(int a, int b, int *arrival)
+{
+  return (arrival[a] != arrival[b]) ? arrival[a] - arrival[b] : a - b;
+}
+
+sweep_result *schedule_sweep(list *processes, priority_queue *queues, int nqueues,
+                             const sched_config *config, int queue, int *quanta, int nquanta)
+{
+  sweep_batch b;
+  sweep_result *r;
+  node_iterator it;
+  process *p;
+  int i;
+  int j;
+  int q;
+  int first;
+  int tmp;
+
+  r = (sweep_result *)malloc(sizeof(sweep_result) * (nquanta > 0 ? nquanta : 1));
+
+  b.n = processes->count;
+  b.nqueues = nqueues;
+  b.config = config;
+  b.arrival = (int *)malloc(sizeof(int) * (b.n + 1));
+  b.execution = (int *)malloc(sizeof(int) * (b.n + 1));
+  b.strat = (strategy *)malloc(sizeof(strategy) * nqueues);
+  b.fixed = (int *)malloc(sizeof(int) * nqueues);
+  b.qcount = (int *)calloc(nqueues, sizeof(int));
+  b.order = (int **)malloc(sizeof(int *) * nqueues);
+  b.ready = (int **)malloc(sizeof(int *) * nqueues);
+  b.remaining = (int *)malloc(sizeof(int) * (b.n + 1) * SWEEP_LANES);
+  b.cpu = (int *)malloc(sizeof(int) * (b.n + 1) * SWEEP_LANES);
+  b.left = (int *)malloc(sizeof(int) * (b.n + 1) * SWEEP_LANES);
+  b.quantum = (int *)malloc(sizeof(int) * nqueues * SWEEP_LANES);
+  b.next_arrival = (int *)malloc(sizeof(int) * nqueues * SWEEP_LANES);
+  b.ready_head = (int *)malloc(sizeof(int) * nqueues * SWEEP_LANES);
+  b.ready_count = (int *)malloc(sizeof(int) * nqueues * SWEEP_LANES);
+
+  for (i = 0, it = head(processes); it != 0; it = next(it), i++)
+  {
+    p = (process *)it->data;
+    b.arrival[i] = p->arrival_time;
+    b.execution[i] = p->execution_time;
+    b.qcount[p->priority]++;
+  }
+
+  for (q = 0; q < nqueues; q++)
+  {
+    b.strat[q] = queues[q].strategy;
+    b.fixed[q] = (queues[q].strategy == RR && queues[q].quantum > 0) ? queues[q].quantum : NO_QUANTUM;
+    b.order[q] = (int *)malloc(sizeof(int) * (b.qcount[q] + 1));
+    b.ready[q] = (int *)malloc(sizeof(int) * (b.qcount[q] + 1) * SWEEP_LANES);
+    b.qcount[q] = 0;
+  }
+
+  // Ordenar los procesos de cada cola por tiempo de llegada
+  for (i = 0, it = head(processes); it != 0; it = next(it), i++)
+  {
+    p = (process *)it->data;
+    q = p->priority;
+    j = b.qcount[q]++;
+    b.order[q][j] = i;
+    while (j > 0 && compare_index_arrival(b.order[q][j - 1], b.order[q][j], b.arrival) > 0)
+    {
+      tmp = b.order[q][j - 1];
+      b.order[q][j - 1] = b.order[q][j];
+      b.order[q][j] = tmp;
+      j--;
+    }
+  }
+
+  // Simular los valores de quantum en lotes de SWEEP_LANES carriles
+  for (first = 0; first < nquanta; first += SWEEP_LANES)
+  {
+    b.lanes = min(SWEEP_LANES, nquanta - first);
+    run_batch(&b, queue, quanta + first, r + first);
+  }
+
+  for (q = 0; q < nqueues; q++)
+  {
+    free(b.order[q]);
+    free(b.ready[q]);
+  }
+  free(b.arrival);
+  free(b.execution);
+  free(b.strat);
+  free(b.fixed);
+  free(b.qcount);
+  free(b.order);
+  free(b.ready);
+  free(b.remaining);
+  free(b.cpu);
+  free(b.left);
+  free(b.quantum);
+  free(b.next_arrival);
+  free(b.ready_head);
+  free(b.ready_count);
+
+  return r;
+}
+
+void print_sweep_results(sweep_result *r, int nquanta, int queue, int nprocesses)
+{
+  int i;
+  double n;
+
+  n = (nprocesses > 0) ? nprocesses : 1;
+  printf("Quantum sweep on queue %d (%d configurations, %d per batch)\n", queue + 1, nquanta, SWEEP_LANES);
+  printf("%8s%12s%11s%11s%10s%12s%10s\n", "Quantum", "Total wait", "Avg. wait", "Avg. turn.", "Makespan", "Dispatches", "Overhead");
+  for (i = 0; i < nquanta; i++)
+  {
+    printf("%8d%12ld%11.3f%11.3f%10d%12ld%10ld\n", r[i].quantum, r[i].total_waiting,
+           r[i].total_waiting / n, r[i].total_turnaround / n, r[i].makespan, r[i].dispatches, r[i].overhead);
+  }
+}
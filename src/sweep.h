@@ -0,0 +1,57 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+/**
+ * @file
+ * @brief Simulacion por lotes de varios valores de quantum en paralelo.
+ * @copyright MIT License
+ *
+ * Cada configuracion (valor de quantum) ocupa un carril. El estado de los
+ * procesos se almacena como estructura de arreglos, con los carriles de un
+ * mismo proceso contiguos, y todos los carriles avanzan juntos de evento en
+ * evento. La contabilidad de los carriles se escribe como ciclos de ancho
+ * fijo para que el compilador los vectorice.
+ */
+
+#include "list.h"
+#include "sched.h"
+
+/** @brief Cantidad de configuraciones que avanzan juntas */
+#define SWEEP_LANES 16
+
+/** @brief Resultado de una configuracion del barrido */
+typedef struct
+{
+  int quantum;           /*!< Quantum de la configuracion */
+  long total_waiting;    /*!< Tiempo total de espera */
+  long total_turnaround; /*!< Tiempo total de retorno */
+  int makespan;          /*!< Tiempo de finalizacion del ultimo proceso */
+  long dispatches;       /*!< Cantidad de asignaciones de CPU */
+  long overhead;         /*!< Tiempo perdido en cambios de contexto y recarga de cache */
+} sweep_result;
+
+/**
+ * @brief Simula la carga de trabajo con varios valores de quantum.
+ * @param processes Lista de procesos.
+ * @param queues Arreglo de colas de prioridad.
+ * @param nqueues Cantidad de colas de prioridad.
+ * @param config Parametros de la simulacion (costos de cambio de contexto).
+ * @param queue Cola de prioridad (0 ... nqueues - 1) cuyo quantum varia.
+ * @param quanta Valores de quantum a simular.
+ * @param nquanta Cantidad de valores de quantum.
+ * @return Arreglo con un resultado por cada valor de quantum.
+ * @note Los procesos no se modifican.
+ */
+sweep_result *schedule_sweep(list *processes, priority_queue *queues, int nqueues,
+                             const sched_config *config, int queue, int *quanta, int nquanta);
+
+/**
+ * @brief Imprime los resultados de un barrido de quantum.
+ * @param r Resultados
+ * @param nquanta Cantidad de resultados
+ * @param queue Cola de prioridad cuyo quantum varia
+ * @param nprocesses Cantidad de procesos simulados
+ */
+void print_sweep_results(sweep_result *r, int nquanta, int queue, int nprocesses);
+
+#endif
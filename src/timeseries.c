@@ -0,0 +1,129 @@
+/**
+ * @file
+ * @brief Serie de tiempo de la simulacion exacta, por ventanas de tiempo fijas.
+ * @copyright MIT License
+ */
+
+#include <stdlib.h>
+
+#include "policy.h"
+#include "timeseries.h"
+
+time_series *create_series(const char *path, int window, int nqueues, int ncpus)
+{
+  time_series *ts;
+  FILE *out;
+  int i;
+
+  out = fopen(path, "w");
+  if (out == NULL)
+  {
+    fprintf(stderr, "Unable to create time series %s\n", path);
+    return NULL;
+  }
+
+  ts = (time_series *)malloc(sizeof(time_series));
+  ts->out = out;
+  ts->window = window;
+  ts->nqueues = nqueues;
+  ts->ncpus = ncpus;
+  ts->start = 0;
+  ts->last = 0;
+  ts->arrivals = 0;
+  ts->completions = 0;
+  ts->busy = 0;
+  ts->depth = (long *)calloc(nqueues, sizeof(long));
+  ts->max_depth = (int *)calloc(nqueues, sizeof(int));
+  ts->ready = (int *)calloc(nqueues, sizeof(int));
+
+  fprintf(out, "start,end,arrivals,completions,cpu_busy");
+  for (i = 0; i < nqueues; i++)
+  {
+    fprintf(out, ",q%d_avg_depth,q%d_max_depth", i + 1, i + 1);
+  }
+  fprintf(out, "\n");
+  return ts;
+}
+
+/**
+ * @brief Escribe la ventana actual y la vacia
+ * @param ts Serie de tiempo
+ * @param end Fin de la ventana
+ */
+static void write_window(time_series *ts, int end)
+{
+  int length;
+  int i;
+
+  length = end - ts->start;
+  fprintf(ts->out, "%d,%d,%ld,%ld,%.3f", ts->start, end, ts->arrivals, ts->completions,
+          (length > 0) ? (double)ts->busy / ((double)length * ts->ncpus) : 0.0);
+  for (i = 0; i < ts->nqueues; i++)
+  {
+    fprintf(ts->out, ",%.3f,%d", (length > 0) ? (double)ts->depth[i] / length : 0.0, ts->max_depth[i]);
+    ts->depth[i] = 0;
+    ts->max_depth[i] = 0;
+  }
+  fprintf(ts->out, "\n");
+
+  ts->start = end;
+  ts->arrivals = 0;
+  ts->completions = 0;
+  ts->busy = 0;
+}
+
+/**
+ * @brief Integra un estado constante desde ts->last hasta un tiempo
+ * @param ts Serie de tiempo
+ * @param depth Procesos listos de cada cola
+ * @param busy Procesadores ocupados
+ * @param to Fin del intervalo, dentro de la ventana actual
+ */
+static void integrate(time_series *ts, const int *depth, int busy, int to)
+{
+  int length;
+  int i;
+
+  length = to - ts->last;
+  if (length <= 0)
+  {
+    return;
+  }
+  ts->busy += (long)busy * length;
+  for (i = 0; i < ts->nqueues; i++)
+  {
+    ts->depth[i] += (long)depth[i] * length;
+    ts->max_depth[i] = max(ts->max_depth[i], depth[i]);
+  }
+  ts->last = to;
+}
+
+void advance_series(time_series *ts, priority_queue *queues, int busy, int now)
+{
+  int i;
+
+  for (i = 0; i < ts->nqueues; i++)
+  {
+    ts->ready[i] = queues[i].ops->count(&queues[i]);
+  }
+  // Cerrar las ventanas que terminan antes del siguiente evento, aunque no tengan eventos
+  while (now >= ts->start + ts->window)
+  {
+    integrate(ts, ts->ready, busy, ts->start + ts->window);
+    write_window(ts, ts->start + ts->window);
+  }
+  integrate(ts, ts->ready, busy, now);
+}
+
+void close_series(time_series *ts)
+{
+  if (ts->last > ts->start || ts->arrivals > 0 || ts->completions > 0)
+  {
+    write_window(ts, ts->last);
+  }
+  fclose(ts->out);
+  free(ts->depth);
+  free(ts->max_depth);
+  free(ts->ready);
+  free(ts);
+}
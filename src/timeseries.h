@@ -0,0 +1,63 @@
+#ifndef TIMESERIES_H
+#define TIMESERIES_H
+
+/**
+ * @file
+ * @brief Serie de tiempo de la simulacion exacta, por ventanas de tiempo fijas.
+ * @copyright MIT License
+ *
+ * Con DEFINE window N, el ciclo de simulacion integra el estado del sistema
+ * entre eventos consecutivos: procesos listos en cada cola y procesadores
+ * ocupados. Al cerrar cada ventana de N unidades se escribe una linea CSV
+ * con las llegadas, los procesos terminados, la fraccion de CPU ocupada y la
+ * profundidad media y maxima de cada cola de listos. El costo por evento es
+ * proporcional a la cantidad de colas, no a la de procesos.
+ */
+
+#include <stdio.h>
+
+#include "sched.h"
+
+/** @brief Acumuladores de la ventana actual de la serie de tiempo */
+typedef struct
+{
+  FILE *out;        /*!< Archivo CSV */
+  int window;       /*!< Ancho de las ventanas */
+  int nqueues;      /*!< Cantidad de colas de prioridad */
+  int ncpus;        /*!< Cantidad de procesadores */
+  int start;        /*!< Inicio de la ventana actual */
+  int last;         /*!< Tiempo hasta el cual se ha integrado el estado */
+  long arrivals;    /*!< Llegadas en la ventana */
+  long completions; /*!< Procesos terminados en la ventana */
+  long busy;        /*!< Integral de los procesadores ocupados en la ventana */
+  long *depth;      /*!< Integral de los procesos listos de cada cola en la ventana */
+  int *max_depth;   /*!< Maximo de procesos listos de cada cola en la ventana */
+  int *ready;       /*!< Procesos listos de cada cola desde el ultimo evento */
+} time_series;
+
+/**
+ * @brief Crea la serie de tiempo y escribe el encabezado CSV
+ * @param path Archivo CSV
+ * @param window Ancho de las ventanas, mayor que cero
+ * @param nqueues Cantidad de colas de prioridad
+ * @param ncpus Cantidad de procesadores
+ * @return Serie de tiempo, NULL si el archivo no se puede crear
+ */
+time_series *create_series(const char *path, int window, int nqueues, int ncpus);
+
+/**
+ * @brief Integra el estado del sistema hasta un tiempo, escribiendo las ventanas que se cierran
+ * @param ts Serie de tiempo
+ * @param queues Arreglo de colas de prioridad, con los procesos listos desde el ultimo evento
+ * @param busy Procesadores ocupados desde el ultimo evento
+ * @param now Tiempo del siguiente evento
+ */
+void advance_series(time_series *ts, priority_queue *queues, int busy, int now);
+
+/**
+ * @brief Escribe la ultima ventana, incompleta, y cierra el archivo
+ * @param ts Serie de tiempo
+ */
+void close_series(time_series *ts);
+
+#endif
@@ -0,0 +1,385 @@
+/**
+ * @file
+ * @brief Exportacion de la simulacion exacta en formato Trace Event JSON.
+ * @copyright MIT License
+ *
+ * La simulacion (productor) escribe registros binarios de tamano fijo en un
+ * anillo de un productor y un consumidor, sin bloqueos: cada lado solo
+ * escribe su propio indice, y lo publica con orden release/acquire. El hilo
+ * escritor (consumidor) da formato a los registros y los escribe en el
+ * archivo, de modo que la simulacion nunca espera por E/S.
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "policy.h"
+#include "traceexport.h"
+
+/** @brief PID de los tracks de procesos en el visor */
+#define TRACK_PROCESSES 1
+
+/** @brief PID de los tracks de procesadores en el visor */
+#define TRACK_CPUS 2
+
+/** @brief Espera del escritor cuando el anillo esta vacio, en nanosegundos */
+#define WRITER_IDLE 100000
+
+/** @brief Tipos de registro del anillo */
+typedef enum
+{
+  RECORD_NAME,    /*!< Nombre de un track */
+  RECORD_SLICE,   /*!< Tramo en el track de un proceso */
+  RECORD_CPU,     /*!< Tramo en el track de un procesador */
+  RECORD_PREEMPT, /*!< Expropiacion */
+  RECORD_DEPTH    /*!< Contador de procesos listos de una cola */
+} record_kind;
+
+/** @brief Registro de tamano fijo del anillo */
+typedef struct
+{
+  int kind;           /*!< Tipo de registro (record_kind) */
+  int type;           /*!< Tipo del tramo, grupo del track (RECORD_NAME) o cola (RECORD_DEPTH) */
+  int track;          /*!< PID del proceso o numero del procesador */
+  int from;           /*!< Inicio, o tiempo del evento */
+  int to;             /*!< Fin, o procesos listos (RECORD_DEPTH) */
+  const char *name;   /*!< Nombre del proceso o del track, internado o constante */
+  const char *detail; /*!< Causa de la expropiacion */
+  const char *by;     /*!< Proceso que causa la expropiacion, NULL si no hay */
+} trace_record;
+
+/** @brief Estado de la exportacion abierta */
+typedef struct
+{
+  trace_record *ring;     /*!< Anillo de TRACE_RING registros */
+  atomic_ulong head;      /*!< Registros escritos por la simulacion (solo el productor lo modifica) */
+  atomic_ulong tail;      /*!< Registros consumidos por el escritor (solo el consumidor lo modifica) */
+  atomic_int closing;     /*!< 1 cuando la simulacion termino y el escritor debe vaciar el anillo */
+  int drop;               /*!< 1 si se descartan los registros con el anillo lleno, 0 si se espera */
+  unsigned long dropped;  /*!< Registros descartados con el anillo lleno */
+  unsigned long stalls;   /*!< Veces que la simulacion espero por espacio en el anillo */
+  pthread_t writer;       /*!< Hilo escritor */
+  const char *path;       /*!< Archivo JSON */
+  FILE *out;              /*!< Archivo JSON, usado solo por el escritor */
+  char *buffer;           /*!< Buffer de escritura de out */
+  int nqueues;            /*!< Cantidad de colas de prioridad */
+  int *depth;             /*!< Ultimo valor enviado del contador de cada cola, -1 si ninguno */
+} trace_export;
+
+/** @brief Exportacion abierta, NULL si no hay */
+static trace_export *exporter = NULL;
+
+/** @brief Nombres de los tipos de tramo */
+static const char *slice_names[] = {"CPU", "WAIT", "IO", "SWITCH", "RELOAD", "MIGRATE", "THROTTLED"};
+
+/**
+ * @brief Escribe una cadena JSON, con las comillas y barras escapadas
+ * @param out Archivo
+ * @param s Cadena
+ */
+static void write_string(FILE *out, const char *s)
+{
+  putc('"', out);
+  for (; *s != 0; s++)
+  {
+    if (*s == '"' || *s == '\\')
+    {
+      putc('\\', out);
+    }
+    if ((unsigned char)*s >= ' ')
+    {
+      putc(*s, out);
+    }
+  }
+  putc('"', out);
+}
+
+/**
+ * @brief Da formato a un registro y lo escribe en el archivo
+ * @param out Archivo
+ * @param r Registro
+ */
+static void write_record(FILE *out, const trace_record *r)
+{
+  switch (r->kind)
+  {
+  case RECORD_NAME:
+    fprintf(out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":", r->type,
+            r->track);
+    if (r->name != NULL)
+    {
+      write_string(out, r->name);
+    }
+    else
+    {
+      fprintf(out, "\"CPU %d\"", r->track);
+    }
+    fprintf(out, "}}");
+    break;
+  case RECORD_SLICE:
+    fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%d,\"dur\":%d}",
+            slice_names[r->type], TRACK_PROCESSES, r->track, r->from, r->to - r->from);
+    break;
+  case RECORD_CPU:
+    // Los tramos de CPU llevan el nombre del proceso; los de sobrecosto, su tipo
+    fprintf(out, ",\n{\"name\":");
+    write_string(out, (r->type == CPU) ? r->name : slice_names[r->type]);
+    fprintf(out, ",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%d,\"dur\":%d,\"args\":{\"process\":", TRACK_CPUS,
+            r->track, r->from, r->to - r->from);
+    write_string(out, r->name);
+    fprintf(out, "}}");
+    break;
+  case RECORD_PREEMPT:
+    fprintf(out,
+            ",\n{\"name\":\"preempted\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%d,\"ts\":%d,\"args\":{\"reason\":\"%s\"",
+            TRACK_PROCESSES, r->track, r->from, r->detail);
+    if (r->by != NULL)
+    {
+      fprintf(out, ",\"by\":");
+      write_string(out, r->by);
+    }
+    fprintf(out, "}}");
+    break;
+  case RECORD_DEPTH:
+    fprintf(out, ",\n{\"name\":\"ready q%d\",\"ph\":\"C\",\"pid\":%d,\"ts\":%d,\"args\":{\"processes\":%d}}",
+            r->type + 1, TRACK_PROCESSES, r->from, r->to);
+    break;
+  }
+}
+
+/**
+ * @brief Hilo escritor: consume el anillo hasta que la simulacion termina y el anillo queda vacio
+ * @param arg Exportacion
+ * @return NULL
+ */
+static void *run_writer(void *arg)
+{
+  trace_export *t = (trace_export *)arg;
+  struct timespec idle = {0, WRITER_IDLE};
+  unsigned long tail;
+  unsigned long head;
+  int closing;
+
+  tail = atomic_load_explicit(&t->tail, memory_order_relaxed);
+  for (;;)
+  {
+    // closing se lee antes que head: si ya estaba activo, head incluye todos los registros
+    closing = atomic_load_explicit(&t->closing, memory_order_acquire);
+    head = atomic_load_explicit(&t->head, memory_order_acquire);
+    if (head == tail)
+    {
+      if (closing)
+      {
+        break;
+      }
+      nanosleep(&idle, NULL);
+      continue;
+    }
+    for (; tail != head; tail++)
+    {
+      write_record(t->out, &t->ring[tail & (TRACE_RING - 1)]);
+      // Liberar espacio por lotes, sin esperar a terminar todos los registros disponibles
+      if ((tail & 255) == 255)
+      {
+        atomic_store_explicit(&t->tail, tail + 1, memory_order_release);
+      }
+    }
+    atomic_store_explicit(&t->tail, tail, memory_order_release);
+  }
+  return NULL;
+}
+
+/**
+ * @brief Escribe un registro en el anillo; con el anillo lleno lo descarta o espera al escritor
+ * @param r Registro
+ * @param drop 1 si el registro se descarta con el anillo lleno, 0 si se espera al escritor
+ * @return 1 si el registro quedo en el anillo, 0 si se descarto
+ */
+static int push_record(const trace_record *r, int drop)
+{
+  trace_export *t = exporter;
+  unsigned long head;
+
+  head = atomic_load_explicit(&t->head, memory_order_relaxed);
+  if (head - atomic_load_explicit(&t->tail, memory_order_acquire) == TRACE_RING)
+  {
+    if (drop)
+    {
+      t->dropped++;
+      return 0;
+    }
+    t->stalls++;
+    while (head - atomic_load_explicit(&t->tail, memory_order_acquire) == TRACE_RING)
+    {
+      sched_yield();
+    }
+  }
+  t->ring[head & (TRACE_RING - 1)] = *r;
+  atomic_store_explicit(&t->head, head + 1, memory_order_release);
+  return 1;
+}
+
+/**
+ * @brief Envia el nombre de un track; nunca se descarta, sin el nombre el track no se identifica
+ * @param group Grupo de tracks
+ * @param track Track
+ * @param name Nombre, internado o constante; NULL para "CPU track"
+ */
+static void push_name(int group, int track, const char *name)
+{
+  trace_record r = {RECORD_NAME, group, track, 0, 0, name, NULL, NULL};
+
+  push_record(&r, 0);
+}
+
+int open_trace_export(const char *path, process_table *table, int nqueues, int ncpus, int drop)
+{
+  trace_export *t;
+  int i;
+
+  close_trace_export();
+  t = (trace_export *)malloc(sizeof(trace_export));
+  t->out = fopen(path, "w");
+  if (t->out == NULL)
+  {
+    fprintf(stderr, "Unable to create trace %s\n", path);
+    free(t);
+    return 0;
+  }
+  t->buffer = (char *)malloc(TRACE_BUFFER);
+  setvbuf(t->out, t->buffer, _IOFBF, TRACE_BUFFER);
+  t->ring = (trace_record *)malloc(sizeof(trace_record) * TRACE_RING);
+  atomic_init(&t->head, 0);
+  atomic_init(&t->tail, 0);
+  atomic_init(&t->closing, 0);
+  t->drop = drop;
+  t->dropped = 0;
+  t->stalls = 0;
+  t->path = path;
+  t->nqueues = nqueues;
+  t->depth = (int *)malloc(sizeof(int) * nqueues);
+  for (i = 0; i < nqueues; i++)
+  {
+    t->depth[i] = -1;
+  }
+
+  // Los nombres de los grupos de tracks se escriben antes de iniciar el escritor
+  fprintf(t->out, "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Processes\"}}",
+          TRACK_PROCESSES);
+  fprintf(t->out, ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"CPUs\"}}", TRACK_CPUS);
+  if (pthread_create(&t->writer, NULL, run_writer, t) != 0)
+  {
+    fprintf(stderr, "Unable to start the trace writer\n");
+    fclose(t->out);
+    free(t->buffer);
+    free(t->ring);
+    free(t->depth);
+    free(t);
+    return 0;
+  }
+  exporter = t;
+
+  // Nombres de cada proceso y de cada procesador
+  for (i = 0; i < table->count; i++)
+  {
+    push_name(TRACK_PROCESSES, table_process(table, i)->pid, table_process(table, i)->name);
+  }
+  for (i = 0; i < ncpus; i++)
+  {
+    push_name(TRACK_CPUS, i + 1, NULL);
+  }
+  return 1;
+}
+
+void export_slice(process *p, slice_type type, int from, int to)
+{
+  trace_record r = {RECORD_SLICE, type, p->pid, from, to, NULL, NULL, NULL};
+
+  if (exporter == NULL || to <= from)
+  {
+    return;
+  }
+  push_record(&r, exporter->drop);
+}
+
+void export_cpu_slice(int cpu, process *p, slice_type type, int from, int to)
+{
+  trace_record r = {RECORD_CPU, type, cpu + 1, from, to, p->name, NULL, NULL};
+
+  if (exporter == NULL || to <= from)
+  {
+    return;
+  }
+  push_record(&r, exporter->drop);
+}
+
+void export_preemption(process *p, int now, const char *reason, process *by)
+{
+  trace_record r = {RECORD_PREEMPT, 0, p->pid, now, now, NULL, reason, (by != NULL) ? by->name : NULL};
+
+  if (exporter == NULL)
+  {
+    return;
+  }
+  push_record(&r, exporter->drop);
+}
+
+void export_depth(priority_queue *queues, int now)
+{
+  trace_record r = {RECORD_DEPTH, 0, 0, now, 0, NULL, NULL, NULL};
+  int i;
+
+  if (exporter == NULL)
+  {
+    return;
+  }
+  for (i = 0; i < exporter->nqueues; i++)
+  {
+    r.to = queues[i].ops->count(&queues[i]);
+    if (r.to != exporter->depth[i])
+    {
+      r.type = i;
+      // Si el registro se descarta, el valor se vuelve a enviar en la siguiente llamada
+      if (push_record(&r, exporter->drop))
+      {
+        exporter->depth[i] = r.to;
+      }
+    }
+  }
+}
+
+void close_trace_export(void)
+{
+  trace_export *t = exporter;
+
+  if (t == NULL)
+  {
+    return;
+  }
+  exporter = NULL;
+
+  // El escritor vacia el anillo y termina
+  atomic_store_explicit(&t->closing, 1, memory_order_release);
+  pthread_join(t->writer, NULL);
+  fprintf(t->out, "\n]\n");
+  fclose(t->out);
+
+  printf("Trace saved to %s", t->path);
+  if (t->dropped > 0)
+  {
+    printf(" (%lu events dropped, trace ring full)", t->dropped);
+  }
+  if (t->stalls > 0)
+  {
+    printf(" (simulation waited %lu times for the trace writer)", t->stalls);
+  }
+  printf("\n");
+
+  free(t->buffer);
+  free(t->ring);
+  free(t->depth);
+  free(t);
+}
@@ -0,0 +1,89 @@
+#ifndef TRACEEXPORT_H
+#define TRACEEXPORT_H
+
+/**
+ * @file
+ * @brief Exportacion de la simulacion exacta en formato Trace Event JSON.
+ * @copyright MIT License
+ *
+ * Con DEFINE trace on, la simulacion escribe ARCHIVO.json a medida que
+ * ocurren los eventos, sin recorrer los slices al final. El archivo se abre
+ * con chrome://tracing o https://ui.perfetto.dev:
+ *  - "Processes": un track por proceso con sus tramos CPU, WAIT, IO, SWITCH,
+ *    RELOAD, MIGRATE y THROTTLED, y un evento instantaneo por expropiacion.
+ *  - "CPUs": un track por procesador con los procesos que ejecuta y el
+ *    sobrecosto de cada asignacion.
+ *  - Contadores "ready qN" con los procesos listos de cada cola, escritos
+ *    solo cuando cambian.
+ * Una unidad de tiempo de la simulacion se muestra como un microsegundo.
+ * El exportador es unico para el programa: las funciones export_* no hacen
+ * nada si no hay una exportacion abierta.
+ *
+ * Las funciones export_* solo copian un registro de tamano fijo en un anillo
+ * sin bloqueos; un hilo escritor les da formato y los escribe en el archivo.
+ * Si el anillo se llena, la simulacion espera al escritor (DEFINE trace on,
+ * o DEFINE trace on block) o descarta el registro y lo cuenta (DEFINE trace
+ * on drop). Los nombres de los tracks nunca se descartan.
+ */
+
+#include "sched.h"
+
+/** @brief Tamano del buffer de escritura del archivo */
+#define TRACE_BUFFER (1 << 20)
+
+/** @brief Registros del anillo entre la simulacion y el hilo escritor, potencia de dos */
+#define TRACE_RING (1 << 16)
+
+/**
+ * @brief Abre el archivo, inicia el hilo escritor y envia los nombres de los tracks
+ * @param path Archivo JSON
+ * @param table Tabla de procesos
+ * @param nqueues Cantidad de colas de prioridad
+ * @param ncpus Cantidad de procesadores
+ * @param drop 1 si se descartan los registros con el anillo lleno, 0 si se espera al escritor
+ * @return 1 si el archivo se abrio
+ */
+int open_trace_export(const char *path, process_table *table, int nqueues, int ncpus, int drop);
+
+/**
+ * @brief Escribe un tramo en el track de un proceso
+ * @param p Proceso
+ * @param type Tipo del tramo
+ * @param from Inicio
+ * @param to Fin
+ */
+void export_slice(process *p, slice_type type, int from, int to);
+
+/**
+ * @brief Escribe un tramo en el track de un procesador
+ * @param cpu Procesador
+ * @param p Proceso que ejecuta, o que causa el sobrecosto
+ * @param type CPU, SWITCH, RELOAD o MIGRATE
+ * @param from Inicio
+ * @param to Fin
+ */
+void export_cpu_slice(int cpu, process *p, slice_type type, int from, int to);
+
+/**
+ * @brief Escribe una expropiacion en el track de un proceso
+ * @param p Proceso expropiado
+ * @param now Tiempo actual
+ * @param reason Causa: quantum, priority, srt o edf
+ * @param by Proceso que llega y causa la expropiacion, NULL si no hay
+ */
+void export_preemption(process *p, int now, const char *reason, process *by);
+
+/**
+ * @brief Escribe los contadores de las colas cuyos procesos listos cambiaron
+ * @param queues Arreglo de colas de prioridad
+ * @param now Tiempo desde el cual las colas tienen sus procesos listos actuales
+ */
+void export_depth(priority_queue *queues, int now);
+
+/**
+ * @brief Espera a que el escritor vacie el anillo, termina el arreglo JSON, cierra el archivo
+ * e imprime los registros descartados y las esperas
+ */
+void close_trace_export(void);
+
+#endif
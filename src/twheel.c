@@ -0,0 +1,277 @@
+/**
+ * @file
+ * @brief Rueda de tiempo jerarquica para eventos futuros
+ * @copyright MIT License
+ */
+
+#include <stdlib.h>
+
+#include "twheel.h"
+
+/** @brief Mascara de una ranura dentro de un nivel */
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+
+/** @brief Tipo reservado para las cabeceras de ranura */
+#define SENTINEL -1
+
+/** @brief Indice de la cabecera de desbordamiento */
+#define OVERFLOW_INDEX (WHEEL_LEVELS * WHEEL_SLOTS)
+
+/**
+ * @brief Inicializa la cabecera de una ranura como lista circular vacia
+ * @param s Cabecera
+ * @param index Indice de la ranura (nivel * WHEEL_SLOTS + ranura)
+ */
+static void init_sentinel(event *s, int index)
+{
+  s->time = index;
+  s->type = SENTINEL;
+  s->data = 0;
+  s->next = s;
+  s->prev = s;
+}
+
+/**
+ * @brief Agrega un evento al final de la ranura que le corresponde
+ * @param w Rueda de tiempo
+ * @param e Evento
+ */
+static void link_event(timing_wheel *w, event *e)
+{
+  unsigned int diff;
+  event *s;
+  int level;
+  int slot;
+
+  // El nivel es el primero en el que el evento y el tiempo actual comparten el bloque
+  diff = (unsigned int)e->time ^ (unsigned int)w->now;
+  s = &w->overflow;
+  for (level = 0; level < WHEEL_LEVELS; level++)
+  {
+    if ((diff >> (WHEEL_BITS * (level + 1))) == 0)
+    {
+      slot = (e->time >> (WHEEL_BITS * level)) & WHEEL_MASK;
+      s = &w->slots[level][slot];
+      w->occupied[level] |= 1ULL << slot;
+      break;
+    }
+  }
+
+  e->prev = s->prev;
+  e->next = s;
+  s->prev->next = e;
+  s->prev = e;
+}
+
+/**
+ * @brief Quita un evento de su ranura
+ * @param w Rueda de tiempo
+ * @param e Evento
+ */
+static void unlink_event(timing_wheel *w, event *e)
+{
+  event *s;
+
+  e->prev->next = e->next;
+  e->next->prev = e->prev;
+
+  // Si la ranura queda vacia, sus dos vecinos son la cabecera
+  s = e->next;
+  if (s->type == SENTINEL && s->next == s && s->time != OVERFLOW_INDEX)
+  {
+    w->occupied[s->time / WHEEL_SLOTS] &= ~(1ULL << (s->time % WHEEL_SLOTS));
+  }
+  e->next = e->prev = 0;
+}
+
+/**
+ * @brief Redistribuye los eventos de una ranura de acuerdo con el tiempo actual
+ * @param w Rueda de tiempo
+ * @param s Cabecera de la ranura
+ */
+static void cascade(timing_wheel *w, event *s)
+{
+  event *e;
+  event *aux;
+
+  e = s->next;
+  s->prev->next = 0;
+  s->next = s->prev = s;
+  if (s->time != OVERFLOW_INDEX)
+  {
+    w->occupied[s->time / WHEEL_SLOTS] &= ~(1ULL << (s->time % WHEEL_SLOTS));
+  }
+
+  // Conservar el orden de programacion de los eventos
+  while (e != 0)
+  {
+    aux = e->next;
+    link_event(w, e);
+    e = aux;
+  }
+}
+
+timing_wheel *create_wheel(int now)
+{
+  timing_wheel *ret;
+  int level;
+  int slot;
+
+  ret = (timing_wheel *)malloc(sizeof(timing_wheel));
+  ret->now = now;
+  ret->count = 0;
+  ret->free_events = 0;
+  for (level = 0; level < WHEEL_LEVELS; level++)
+  {
+    ret->occupied[level] = 0;
+    for (slot = 0; slot < WHEEL_SLOTS; slot++)
+    {
+      init_sentinel(&ret->slots[level][slot], level * WHEEL_SLOTS + slot);
+    }
+  }
+  init_sentinel(&ret->overflow, OVERFLOW_INDEX);
+
+  return ret;
+}
+
+void destroy_wheel(timing_wheel *w)
+{
+  event *e;
+  event *aux;
+  int level;
+  int slot;
+
+  if (w == 0)
+  {
+    return;
+  }
+  for (level = 0; level < WHEEL_LEVELS; level++)
+  {
+    for (slot = 0; slot < WHEEL_SLOTS; slot++)
+    {
+      for (e = w->slots[level][slot].next; e->type != SENTINEL; e = aux)
+      {
+        aux = e->next;
+        free(e);
+      }
+    }
+  }
+  for (e = w->overflow.next; e->type != SENTINEL; e = aux)
+  {
+    aux = e->next;
+    free(e);
+  }
+  for (e = w->free_events; e != 0; e = aux)
+  {
+    aux = e->next;
+    free(e);
+  }
+  free(w);
+}
+
+event *wheel_schedule(timing_wheel *w, int time, int type, void *data)
+{
+  event *e;
+
+  if (w->free_events != 0)
+  {
+    e = w->free_events;
+    w->free_events = e->next;
+  }
+  else
+  {
+    e = (event *)malloc(sizeof(event));
+  }
+
+  // Un evento en el pasado se programa para el tiempo actual
+  e->time = (time < w->now) ? w->now : time;
+  e->type = type;
+  e->data = data;
+  link_event(w, e);
+  w->count++;
+
+  return e;
+}
+
+void wheel_cancel(timing_wheel *w, event *e)
+{
+  if (e == 0 || e->next == 0)
+  {
+    return;
+  }
+  unlink_event(w, e);
+  w->count--;
+  wheel_release(w, e);
+}
+
+event *wheel_pop(timing_wheel *w)
+{
+  unsigned long long bits;
+  event *e;
+  int level;
+  int index;
+  int slot;
+  int min_time;
+
+  if (w->count == 0)
+  {
+    return 0;
+  }
+
+  for (;;)
+  {
+    // Eventos del bloque actual en el nivel 0
+    index = w->now & WHEEL_MASK;
+    bits = w->occupied[0] & (~0ULL << index);
+    if (bits != 0)
+    {
+      slot = __builtin_ctzll(bits);
+      w->now = (w->now & ~WHEEL_MASK) | slot;
+      e = w->slots[0][slot].next;
+      unlink_event(w, e);
+      w->count--;
+      return e;
+    }
+
+    // Saltar al siguiente bloque no vacio de un nivel superior y redistribuirlo
+    for (level = 1; level < WHEEL_LEVELS; level++)
+    {
+      index = (w->now >> (WHEEL_BITS * level)) & WHEEL_MASK;
+      bits = (index == WHEEL_MASK) ? 0 : w->occupied[level] & (~0ULL << (index + 1));
+      if (bits != 0)
+      {
+        slot = __builtin_ctzll(bits);
+        w->now = (int)(((unsigned int)w->now >> (WHEEL_BITS * (level + 1)) << (WHEEL_BITS * (level + 1))) |
+                       ((unsigned int)slot << (WHEEL_BITS * level)));
+        cascade(w, &w->slots[level][slot]);
+        break;
+      }
+    }
+
+    if (level == WHEEL_LEVELS)
+    {
+      // Solo quedan eventos fuera del alcance de la rueda
+      min_time = w->overflow.next->time;
+      for (e = w->overflow.next; e->type != SENTINEL; e = e->next)
+      {
+        if (e->time < min_time)
+        {
+          min_time = e->time;
+        }
+      }
+      w->now = min_time;
+      cascade(w, &w->overflow);
+    }
+  }
+}
+
+void wheel_release(timing_wheel *w, event *e)
+{
+  e->next = w->free_events;
+  w->free_events = e;
+}
+
+int wheel_due(const timing_wheel *w)
+{
+  return (w->occupied[0] >> (w->now & WHEEL_MASK)) & 1;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file
+ * @brief Rueda de tiempo jerarquica para eventos futuros
+ * @copyright MIT License
+ *
+ * La rueda tiene WHEEL_LEVELS niveles de WHEEL_SLOTS ranuras. El nivel 0
+ * guarda los eventos del bloque actual de WHEEL_SLOTS unidades de tiempo, el
+ * nivel 1 los del bloque actual de WHEEL_SLOTS^2 unidades, y asi
+ * sucesivamente. Al avanzar, las ranuras de un nivel superior se redistribuyen
+ * en los niveles inferiores. La insercion y la eliminacion son O(1), y el
+ * avance es O(1) amortizado. Un mapa de bits por nivel permite saltar las
+ * ranuras vacias.
+ */
+
+#ifndef TWHEEL_H
+#define TWHEEL_H
+
+/** @brief Bits de tiempo por nivel */
+#define WHEEL_BITS 6
+
+/** @brief Ranuras por nivel */
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+
+/** @brief Cantidad de niveles */
+#define WHEEL_LEVELS 5
+
+/** @brief Evento programado */
+typedef struct event
+{
+  int time;           /*!< Tiempo del evento */
+  int type;           /*!< Tipo de evento (definido por quien lo programa) */
+  void *data;         /*!< Dato asociado al evento */
+  struct event *next; /*!< Siguiente evento de la ranura */
+  struct event *prev; /*!< Evento anterior de la ranura */
+} event;
+
+/** @brief Rueda de tiempo jerarquica */
+typedef struct
+{
+  int now;                                      /*!< Tiempo actual de la rueda */
+  int count;                                    /*!< Cantidad de eventos programados */
+  unsigned long long occupied[WHEEL_LEVELS];    /*!< Ranuras no vacias de cada nivel */
+  event slots[WHEEL_LEVELS][WHEEL_SLOTS];       /*!< Cabeceras de las ranuras */
+  event overflow;                               /*!< Eventos fuera del alcance de la rueda */
+  event *free_events;                           /*!< Eventos disponibles para reutilizar */
+} timing_wheel;
+
+/**
+ * @brief Crea una rueda de tiempo vacia
+ * @param now Tiempo inicial
+ * @return Nueva rueda de tiempo
+ */
+timing_wheel *create_wheel(int now);
+
+/**
+ * @brief Libera la rueda, sus eventos programados y los eventos reutilizables
+ * @param w Rueda de tiempo
+ */
+void destroy_wheel(timing_wheel *w);
+
+/**
+ * @brief Programa un nuevo evento
+ * @param w Rueda de tiempo
+ * @param time Tiempo del evento, mayor o igual al tiempo actual de la rueda
+ * @param type Tipo de evento
+ * @param data Dato asociado
+ * @return Evento programado, que puede cancelarse con wheel_cancel
+ */
+event *wheel_schedule(timing_wheel *w, int time, int type, void *data);
+
+/**
+ * @brief Cancela un evento programado
+ * @param w Rueda de tiempo
+ * @param e Evento a cancelar
+ */
+void wheel_cancel(timing_wheel *w, event *e);
+
+/**
+ * @brief Retira el siguiente evento, avanzando el tiempo de la rueda hasta el.
+ * Los eventos de un mismo tiempo se retiran en el orden en que se programaron.
+ * @param w Rueda de tiempo
+ * @return Siguiente evento, 0 si no hay eventos. Debe liberarse con wheel_release.
+ */
+event *wheel_pop(timing_wheel *w);
+
+/**
+ * @brief Devuelve un evento retirado para su reutilizacion
+ * @param w Rueda de tiempo
+ * @param e Evento retirado con wheel_pop
+ */
+void wheel_release(timing_wheel *w, event *e);
+
+/**
+ * @brief Verifica si quedan eventos en el tiempo actual de la rueda
+ * @param w Rueda de tiempo
+ * @return 1 si hay eventos pendientes en el tiempo actual, 0 en caso contrario
+ */
+int wheel_due(const timing_wheel *w);
+
+#endif